@@ -0,0 +1,1833 @@
+/*
+  BenchmarkLoopback_WiFi
+
+  This sketch measures the latency of browseServer(), searchServer() and readStart()/read()
+  without the need of a real media server next to the board. We use builtin WiFi.
+
+  A small stand-in ContentDirectory server is started as a separate task on this ESP32. It
+  answers Browse/Search requests with canned replies (modeled on the UMS, Denon-HEOS and Kodi
+  replies found in folder doc/Logfiles), either chunked or not chunked, and serves dummy files
+  for download. The library talks to it via the loopback interface (our own IP address).
+
+  The object id requested from the stand-in server selects the reply:
+    "<profile>/<number of objects>/<chunk size>", e.g. "ums/100/1460"
+  with chunk size 0 meaning the reply is not chunked. The download uri is built the same way:
+    "file/<file size>/<chunk size>[/<stall ms>/<stall every kB>[/<kB/s>]]"
+  with the optional part making the stand-in server pause like a stalled network and limiting
+  the bandwidth of a connection. Downloads support HTTP ranges, unless the uri starts with 
+  "norange" instead of "file".
+
+  For each scenario the sketch prints objects/s, bytes/s (both using a result list) and the 
+  time-to-first-object (using the callback variants of browseServer()/searchServer()), so
+  regressions in the parse and HTTP paths of the library show up as numbers. Downloads are 
+  de-chunked with different chunk sizes, incl. chunk extensions & trailer, compared to a download
+  not chunked. Sequential browses
+  of a small directory show the gain of reusing the connection (HTTP keep-alive), incl. the 
+  fallback with a server that closes the connection anyway. The time needed to assemble & send
+  a request is measured up to its arrival at the stand-in server. The heap usage of result 
+  lists (soapObjectVect_t) and compact result sets (SoapResultSet) is compared: heap blocks & 
+  bytes held by the result, peak heap usage while browsing (needs ESP-IDF >= 5.3) and the 
+  largest free heap block left. Finally seekServer() gets timed with several stand-in servers
+  announcing themselves via SSDP NOTIFY, each one delaying its device description by a 
+  different amount of time (one never answers), fetched one after the other and at once. The
+  same servers are sought with seekServerUntil(), which stops as soon as a condition is met
+  (first server, a certain unique device name, no new server for a while) and finally with
+  seekServerAsync() driven by poll(). As with asynchronous browses (incl. connecting to the
+  server) the longest call of poll() is shown. Last not least the server list found gets saved
+  and restored with restoreServerList(), which only checks if the servers are still reachable
+  (incl. fallback to a full scan). Repeated browses with the result
+  cache enabled (setCache()) show the time of a cache hit compared to the request sent to the
+  server, incl. dropping cached results after the server's SystemUpdateID changed. With an event
+  subscription (subscribeEvents()) the stand-in server notifies a changed directory (GENA NOTIFY),
+  the time until the cached directory has been dropped is shown as well as automatic renewals of a
+  short subscription. An event message with a late body and renewals answered late show the longest
+  poll(), it doesn't wait for them. A simulated audio decoder reads a download at a fixed rate while the stand-in
+  server stalls now and then, directly and with read-ahead (setReadAhead()): the slowest read, the
+  number of reads delaying the decoder and the underruns of the read-ahead buffer. Seeking within a
+  file is timed with a range request compared to reading up to the same position. A download gets
+  handed to a checksum with read() & buffer of the sketch and without buffer using readTo(). A file served
+  with limited bandwidth per connection gets downloaded over several connections at once
+  (downloadSegmented()). A directory gets browsed with each yield policy (setYieldPolicy()), compared
+  to the delay of 1 ms per object older versions of the library made. With build option SOAP_REQUEST_STATS the time line of single requests gets
+  printed (getLastRequestStats()): connected, sent, first byte received, header & reply evaluated,
+  time spent scanning objects. The DIDL-Lite objects found in the logfiles of doc/Logfiles 
+  (DidlCorpus.h) get browsed and every field scanned gets compared with the result of the scanner
+  before it scanned objects in a single pass. Please note that stand-in server and library share the ESP32, so 
+  absolute values are lower than with a real media server. Compare numbers of the same board & build settings only.
+
+  Last updated 2026-10-17, ThJ <yellobyte@bluewin.ch>
+*/
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include "SoapESP32.h"
+#include "DidlCorpus.h"
+#include <esp_heap_caps.h>
+#include <esp_idf_version.h>
+#include <StreamString.h>
+
+// With build option 'SHOW_ESP32_MEMORY_STATISTICS' the sketch prints ESP32 memory stats when finished.
+// The option has already been added to the provided file 'build_opt.h'. Please use it with ArduinoIDE.
+// Have a look at Readme.md for more detailed info about setting build options.
+
+// Stand-in server settings
+#define STANDIN_PORT          49152
+#define STANDIN_CONTROL_URL   "upnp/control/ContentDirectory"
+#define STANDIN_EVENT_URL     "upnp/event/ContentDirectory"
+#define STANDIN_MAX_CHUNK     4096
+#define STANDIN_ITEM_SIZE     2048
+#define STANDIN_KEEP_ALIVE_MS 2000       // idle time before stand-in server closes a kept-alive connection
+
+// Benchmark settings
+#define BENCH_REPEATS         5
+#define READ_BUFFER_SIZE      4096
+#define MEM_PAGES             10         // browse pages per memory scenario
+#define MEM_OBJECT_ID         "ums/100/1460"
+#define SEQ_BROWSES           20         // sequential browses per keep-alive scenario
+#define SEQ_OBJECT_ID         "ums/10/0"
+#define YIELD_OBJECT_ID       "ums/100/1460"  // browsed with different yield policies
+#define REQ_OBJECT_ID         "ums/0/0"  // empty reply, request dominates
+#define CACHE_BROWSES         20         // browses of the same page per cache scenario
+#define CACHE_OBJECT_ID       "ums/100/1460"
+#define CORPUS_OBJECT_ID      "corpus/0/0"   // all objects of DidlCorpus.h
+#define EVENT_PORT            49200      // event listener (GENA NOTIFY) of library
+#define EVENT_TIMEOUT         4          // s, short subscription, gets renewed after 2 s
+#define EVENT_RENEW_WAIT      5000       // ms, time given for renewals
+#define EVENT_WAIT            3000       // ms, max. time for an event to arrive
+#define EVENT_STALL           500        // ms, late event message body & late reply to renewal
+#define STREAM_RATE           200        // kB/s read by simulated decoder
+#define STREAM_BLOCK          4096       // bytes read by simulated decoder at once
+#define STREAM_LATE_MS        10         // reading a block takes longer: decoder gets delayed
+#define RANGE_FILE_SIZE       1048576    // file for seeking with ranges
+#define RANGE_OFFSET          786432     // seek position
+#define RANGE_LENGTH          65536      // bytes read after seeking
+#define SINK_URI              "file/1048576/1460"  // download handed to a checksum
+#define SEGMENT_PORT          49170      // stand-in server handling each connection with a separate task
+#define SEGMENT_FILE_SIZE     524288     // file for segmented download
+#define SEGMENT_RATE          256        // kB/s, bandwidth limit of each connection
+#define DESC_PORT             49160      // first port of stand-in description servers
+#define DESC_SCAN_DURATION    5          // seconds, SSDP part of seekServer()
+#define DESC_NOTIFY_INTERVAL  1000       // ms between SSDP NOTIFY announcements
+
+// delay of device description in ms for each stand-in description server, last one never answers
+const uint32_t descDelays[] = { 0, 500, 1500, 2500, 60000 };
+#define DESC_SERVERS          (sizeof(descDelays) / sizeof(uint32_t))
+
+const char ssid[] = "MySSID";
+const char pass[] = "MyPassword";
+
+WiFiClient client;
+WiFiUDP    udp;
+
+SoapESP32 soap(&client, &udp);
+
+// bytes sent by stand-in server with last reply (HTTP header + body)
+volatile uint32_t standInReplySize = 0;
+// micros() when stand-in server had received the last request completely
+volatile uint32_t standInRequestUs = 0;
+// false: stand-in server ignores keep-alive requests and closes connection after each reply
+volatile bool standInKeepAlive = true;
+// true: stand-in description servers get announced via SSDP NOTIFY
+volatile bool standInAnnounce = false;
+// incremented with each seek, stand-in description servers get announced right away
+volatile uint32_t standInAnnounceRound = 0;
+// reported by stand-in server on GetSystemUpdateID, changed to simulate modified content
+volatile uint32_t standInSystemUpdateId = 1;
+// reported by stand-in server with each browse/search reply and event
+volatile uint32_t standInContainerUpdateId = 1;
+// event subscription at stand-in server: callback url & subscription id (empty if none)
+char standInCallback[80] = "";
+char standInSid[40] = "";
+volatile uint32_t standInSubscriptions = 0;
+volatile uint32_t standInRenewals = 0;
+// true: stand-in server sends an event message, container CACHE_OBJECT_ID changed unless it's the first one
+volatile bool standInNotifyPending = false;
+// ms the stand-in server waits before answering a renewal / sending the body of an event message
+volatile uint32_t standInRenewDelay = 0;
+volatile uint32_t standInNotifyStall = 0;
+// true: chunk size lines of stand-in server carry chunk extensions, final chunk is followed by a trailer
+volatile bool standInChunkExt = false;
+
+// browse/search scenarios
+struct scenario_t {
+  const char *name;
+  const char *objectId;
+  bool        search;
+  unsigned    expected;          // number of objects the stand-in server delivers
+};
+
+const scenario_t scenarios[] = {
+  { "UMS tracks, not chunked",         "ums/100/0",     false, 100 },
+  { "UMS tracks, chunked 1460",        "ums/100/1460",  false, 100 },
+  { "UMS tracks, chunked 128",         "ums/100/128",   false, 100 },
+  { "HEOS inputs, chunked 512",        "heos/100/512",  false, 100 },
+  { "Kodi folders, not chunked",       "kodi/100/0",    false, 100 },
+  { "UMS tracks, prefix m:",           "wmp/100/0",     false, 100 },
+  { "UMS tracks, 3 <res> variants",    "umsres/100/0",  false, 100 },
+  { "UMS tracks, char. references",    "intl/100/0",    false, 100 },
+  { "DIDL corpus, doc/Logfiles",       "corpus/0/0",    false, 100 },
+  { "UMS search, chunked 4096",        "ums/100/4096",  true,  100 }
+};
+
+// download scenarios
+struct download_t {
+  const char *name;
+  const char *uri;
+};
+
+const download_t downloads[] = {
+  { "1 MB file, not chunked",          "file/1048576/0" },
+  { "1 MB file, chunked 1460",         "file/1048576/1460" },
+  { "1 MB file, chunked 4096",         "file/1048576/4096" }
+};
+
+// de-chunking scenarios, first one is the reference
+const download_t chunkings[] = {
+  { "not chunked",                     "file/1048576/0" },
+  { "chunked 64",                      "file/1048576/64" },
+  { "chunked 256",                     "file/1048576/256" },
+  { "chunked 1460",                    "file/1048576/1460" },
+  { "chunked 4096",                    "file/1048576/4096" }
+};
+
+// streaming scenarios, stand-in server stalls regularly
+const download_t streams[] = {
+  { "stall 150 ms every 64 kB",        "file/524288/0/150/64" },
+  { "same, chunked 1460",              "file/524288/1460/150/64" }
+};
+
+// heap numbers, taken before & after browsing
+struct heapStats_t {
+  size_t freeBytes;
+  size_t largestBlock;
+  size_t blocks;                 // number of allocated heap blocks
+};
+
+// bookkeeping of events received
+struct eventRun_t {
+  unsigned events;               // number of events received
+  unsigned containers;           // changed containers reported with last event
+};
+
+// bookkeeping of a browse/search run with callback
+struct callbackRun_t {
+  uint32_t start;                // millis() when request was started
+  uint32_t first;                // ms until first object was reported
+  unsigned objects;              // number of objects reported
+};
+
+//
+// Stand-in media server
+//
+
+// reply body gets either counted, sent straight or sent chunked
+struct replyWriter_t {
+  WiFiClient *client;            // NULL: only count bytes
+  size_t      chunkSize;         // 0: reply not chunked
+  size_t      count;             // bytes counted/sent so far
+  size_t      fill;              // bytes waiting in buffer
+  char        buffer[STANDIN_MAX_CHUNK];
+};
+
+void writerFlush(replyWriter_t *w)
+{
+  if (!w->fill) return;
+  if (w->client) {
+    if (w->chunkSize) w->client->printf(standInChunkExt ? "%x;name=\"value\"\r\n" : "%x\r\n", (unsigned)w->fill);
+    w->client->write((const uint8_t *)w->buffer, w->fill);
+    if (w->chunkSize) w->client->print("\r\n");
+  }
+  w->fill = 0;
+}
+
+void writerPut(replyWriter_t *w, const char *data, size_t len)
+{
+  size_t limit = (w->chunkSize && w->chunkSize < sizeof(w->buffer)) ? w->chunkSize : sizeof(w->buffer);
+
+  w->count += len;
+  if (!w->client) return;
+  while (len) {
+    size_t n = min(len, limit - w->fill);
+    memcpy(w->buffer + w->fill, data, n);
+    w->fill += n;
+    data += n;
+    len -= n;
+    if (w->fill == limit) writerFlush(w);
+  }
+}
+
+void writerPut(replyWriter_t *w, const char *str)
+{
+  writerPut(w, str, strlen(str));
+}
+
+// DIDL-Lite is embedded as escaped XML in the SOAP reply
+void writerPutEscaped(replyWriter_t *w, const char *str)
+{
+  for (const char *p = str; *p; p++) {
+    switch (*p) {
+      case '&': writerPut(w, "&amp;");  break;
+      case '<': writerPut(w, "&lt;");   break;
+      case '>': writerPut(w, "&gt;");   break;
+      case '"': writerPut(w, "&quot;"); break;
+      default:  writerPut(w, p, 1);     break;
+    }
+  }
+}
+
+void writerFinish(replyWriter_t *w)
+{
+  writerFlush(w);
+  if (w->client && w->chunkSize) w->client->print(standInChunkExt ? "0\r\nX-Trailer: 1\r\n\r\n" : "0\r\n\r\n");
+}
+
+// builds a single DIDL-Lite object according to the requested profile
+void standInObject(char *buf, size_t size, const char *profile, const char *parentId, unsigned nr)
+{
+  IPAddress ip = WiFi.localIP();
+
+  if (!strcmp(profile, "kodi")) {
+    // Kodi does not provide childCount
+    snprintf(buf, size,
+      "<container id=\"%s/%u\" parentID=\"%s\" restricted=\"1\" searchable=\"1\">"
+      "<dc:title>Folder %u</dc:title><upnp:class>object.container.storageFolder</upnp:class>"
+      "<upnp:genre></upnp:genre></container>", parentId, nr, parentId, nr);
+  }
+  else if (!strcmp(profile, "heos")) {
+    // Denon-HEOS: vendor specific <desc> elements, no size attribute
+    snprintf(buf, size,
+      "<item id=\"%s/%u\" restricted=\"1\" parentID=\"%s\"><dc:title>Input %u</dc:title>"
+      "<upnp:class>object.item.audioItem.audioBroadcast.input</upnp:class>"
+      "<desc id=\"inputLevel\" nameSpace=\"urn:schemas-denon-com:metadata/\" xmlns:aios=\"urn:schemas-denon-com:metadata/\">0</desc>"
+      "<desc id=\"hidden\" nameSpace=\"urn:schemas-denon-com:metadata/\" xmlns:aios=\"urn:schemas-denon-com:metadata/\">0</desc>"
+      "<desc id=\"inUse\" nameSpace=\"urn:schemas-denon-com:metadata/\" xmlns:aios=\"urn:schemas-denon-com:metadata/\">0</desc>"
+      "<res protocolInfo=\"http-get:*:*:*\">http://%s:%d/file/4096/0</res>"
+      "<upnp:originalTrackNumber>1</upnp:originalTrackNumber><upnp:genre></upnp:genre></item>",
+      parentId, nr, parentId, nr, ip.toString().c_str(), STANDIN_PORT);
+  }
+  else if (!strcmp(profile, "umsres")) {
+    // UMS: audio tracks offered in several formats (transcoding), only the first <res> gets used
+    snprintf(buf, size,
+      "<item id=\"%s/%u\" parentID=\"%s\" restricted=\"1\"><dc:title>Track %u - Rock &amp; Roll</dc:title>"
+      "<upnp:album>Best Of</upnp:album><upnp:artist>Some Artist</upnp:artist><upnp:genre>Pop</upnp:genre>"
+      "<upnp:class>object.item.audioItem.musicTrack</upnp:class>"
+      "<res duration=\"0:03:40.000\" size=\"%u\" bitrate=\"40000\" sampleFrequency=\"44100\" nrAudioChannels=\"2\" "
+      "protocolInfo=\"http-get:*:audio/mpeg:DLNA.ORG_PN=MP3;DLNA.ORG_OP=01;DLNA.ORG_FLAGS=01700000000000000000000000000000\">"
+      "http://%s:%d/file/%u/0</res>"
+      "<res duration=\"0:03:40.000\" bitrate=\"176400\" sampleFrequency=\"44100\" nrAudioChannels=\"2\" "
+      "protocolInfo=\"http-get:*:audio/L16;rate=44100;channels=2:DLNA.ORG_PN=LPCM;DLNA.ORG_OP=10;DLNA.ORG_CI=1;DLNA.ORG_FLAGS=01700000000000000000000000000000\">"
+      "http://%s:%d/file/%u/0?transcode=lpcm</res>"
+      "<res duration=\"0:03:40.000\" bitrate=\"176400\" sampleFrequency=\"44100\" nrAudioChannels=\"2\" "
+      "protocolInfo=\"http-get:*:audio/wav:DLNA.ORG_OP=10;DLNA.ORG_CI=1;DLNA.ORG_FLAGS=01700000000000000000000000000000\">"
+      "http://%s:%d/file/%u/0?transcode=wav</res>"
+      "<desc id=\"artist\" nameSpace=\"urn:schemas-microsoft-com:WMPNSS-1-0/\" xmlns:microsoft=\"urn:schemas-microsoft-com:WMPNSS-1-0/\">"
+      "&lt;microsoft:artistAlbumArtist&gt;Some Artist&lt;/microsoft:artistAlbumArtist&gt;</desc></item>",
+      parentId, nr, parentId, nr, 4000000 + nr, ip.toString().c_str(), STANDIN_PORT, 4000000 + nr,
+      ip.toString().c_str(), STANDIN_PORT, 4000000 + nr, ip.toString().c_str(), STANDIN_PORT, 4000000 + nr);
+  }
+  else if (!strcmp(profile, "intl")) {
+    // UMS: audio tracks with numeric character references & escaped '<', '>' in title, album, artist
+    snprintf(buf, size,
+      "<item id=\"%s/%u\" parentID=\"%s\" restricted=\"1\"><dc:title>Track %u &#x2013; M&#228;dchen &lt;Live&gt;</dc:title>"
+      "<upnp:album>Caf&#233; &amp; Bar &#x2019;98</upnp:album><upnp:artist>Beyonc&#xE9;</upnp:artist><upnp:genre>Pop</upnp:genre>"
+      "<upnp:class>object.item.audioItem.musicTrack</upnp:class>"
+      "<res duration=\"0:03:40.000\" size=\"%u\" bitrate=\"40000\" sampleFrequency=\"44100\" nrAudioChannels=\"2\" "
+      "protocolInfo=\"http-get:*:audio/mpeg:DLNA.ORG_PN=MP3;DLNA.ORG_OP=01;DLNA.ORG_FLAGS=01700000000000000000000000000000\">"
+      "http://%s:%d/file/%u/0</res></item>",
+      parentId, nr, parentId, nr, 4000000 + nr, ip.toString().c_str(), STANDIN_PORT, 4000000 + nr);
+  }
+  else {
+    // UMS: audio tracks with full set of attributes
+    snprintf(buf, size,
+      "<item id=\"%s/%u\" parentID=\"%s\" restricted=\"1\"><dc:title>Track %u - Rock &amp; Roll</dc:title>"
+      "<upnp:album>Best Of</upnp:album><upnp:artist>Some Artist</upnp:artist><upnp:genre>Pop</upnp:genre>"
+      "<upnp:class>object.item.audioItem.musicTrack</upnp:class>"
+      "<res duration=\"0:03:40.000\" size=\"%u\" bitrate=\"40000\" sampleFrequency=\"44100\" nrAudioChannels=\"2\" "
+      "protocolInfo=\"http-get:*:audio/mpeg:DLNA.ORG_PN=MP3;DLNA.ORG_OP=01;DLNA.ORG_FLAGS=01700000000000000000000000000000\">"
+      "http://%s:%d/file/%u/0</res></item>",
+      parentId, nr, parentId, nr, 4000000 + nr, ip.toString().c_str(), STANDIN_PORT, 4000000 + nr);
+  }
+}
+
+// writes SOAP reply body
+void standInBrowseBody(replyWriter_t *w, const char *objectId, bool search, uint32_t startingIndex, uint32_t requestedCount)
+{
+  char profile[10] = "", item[STANDIN_ITEM_SIZE];
+  unsigned total = 0, chunk = 0, returned = 0;
+
+  sscanf(objectId, "%9[a-z]/%u/%u", profile, &total, &chunk);
+  bool fromCorpus = !strcmp(profile, "corpus");
+  if (fromCorpus) total = CORPUS_OBJECTS;
+  const char *ns = strcmp(profile, "wmp") ? "u" : "m";
+  const char *action = search ? "Search" : "Browse";
+
+  writerPut(w, "<?xml version=\"1.0\" encoding=\"utf-8\"?>\r\n");
+  writerPut(w, "<s:Envelope xmlns:s=\"http://schemas.xmlsoap.org/soap/envelope/\" "
+               "s:encodingStyle=\"http://schemas.xmlsoap.org/soap/encoding/\"><s:Body>");
+  snprintf(item, sizeof(item), "<%s:%sResponse xmlns:%s=\"urn:schemas-upnp-org:service:ContentDirectory:1\"><Result>",
+           ns, action, ns);
+  writerPut(w, item);
+  writerPutEscaped(w, "<DIDL-Lite xmlns=\"urn:schemas-upnp-org:metadata-1-0/DIDL-Lite/\" "
+                      "xmlns:dc=\"http://purl.org/dc/elements/1.1/\" "
+                      "xmlns:upnp=\"urn:schemas-upnp-org:metadata-1-0/upnp/\">");
+  for (uint32_t i = startingIndex; i < total && returned < requestedCount; i++, returned++) {
+    if (fromCorpus) {
+      writerPutEscaped(w, corpus[i].didl);
+      continue;
+    }
+    standInObject(item, sizeof(item), profile, objectId, i);
+    writerPutEscaped(w, item);
+  }
+  writerPutEscaped(w, "</DIDL-Lite>");
+  snprintf(item, sizeof(item), "</Result><NumberReturned>%u</NumberReturned><TotalMatches>%u</TotalMatches>"
+           "<UpdateID>%u</UpdateID></%s:%sResponse></s:Body></s:Envelope>\r\n", returned, total, 
+           (unsigned)standInContainerUpdateId, ns, action);
+  writerPut(w, item);
+}
+
+// byte at given position of dummy file content
+uint8_t standInFileByte(uint32_t pos)
+{
+  return 'a' + (pos % 256) % 26;
+}
+
+// writes dummy file content starting at offset first, pausing for stallMs after each stallEvery bytes 
+// sent (0: no stalls) and sending no more than rateKb kB/s (0: no limit)
+void standInFileBody(replyWriter_t *w, uint32_t first, uint32_t length, uint32_t stallMs = 0, uint32_t stallEvery = 0,
+                     uint32_t rateKb = 0)
+{
+  char pattern[256];
+  uint32_t sent = 0, pos = first, start = millis();
+
+  for (int i = 0; i < sizeof(pattern); i++) pattern[i] = standInFileByte(i);
+  while (length) {
+    size_t n = min((size_t)length, sizeof(pattern) - pos % sizeof(pattern));
+    writerPut(w, pattern + pos % sizeof(pattern), n);
+    length -= n;
+    pos += n;
+    sent += n;
+    if (w->client && stallEvery && sent % stallEvery == 0) {
+      writerFlush(w);
+      delay(stallMs);
+    }
+    if (w->client && rateKb) {
+      while ((uint64_t)sent * 1000 > (uint64_t)(millis() - start) * rateKb * 1024) delay(1);
+    }
+  }
+}
+
+// copies content of first XML element <tag> found in body
+bool standInGetTag(const String &body, const char *tag, char *buf, size_t size)
+{
+  String start = String("<") + tag + ">", end = String("</") + tag + ">";
+  int b = body.indexOf(start), e = body.indexOf(end);
+
+  if (b < 0 || e < b) return false;
+  b += start.length();
+  snprintf(buf, size, "%.*s", e - b, body.c_str() + b);
+  return true;
+}
+
+// sends device description after the delay given in uri "desc/<delay>"
+void standInDescription(WiFiClient *c, const char *uri, uint32_t ms)
+{
+  char body[600];
+
+  delay(ms);
+  snprintf(body, sizeof(body),
+    "<?xml version=\"1.0\"?>\r\n<root xmlns=\"urn:schemas-upnp-org:device-1-0\">"
+    "<specVersion><major>1</major><minor>0</minor></specVersion><device>"
+    "<deviceType>" SSDP_DEVICE_TYPE_MS "</deviceType><friendlyName>Stand-in %s</friendlyName>"
+    "<UDN>uuid:stand-in-%u</UDN><serviceList><service>"
+    "<serviceType>" SSDP_SERVICE_TYPE_CD "</serviceType><serviceId>urn:upnp-org:serviceId:ContentDirectory</serviceId>"
+    "<SCPDURL>upnp/cds.xml</SCPDURL><controlURL>/" STANDIN_CONTROL_URL "</controlURL>"
+    "<eventSubURL>" STANDIN_EVENT_URL "</eventSubURL></service></serviceList></device></root>\r\n",
+    uri, (unsigned)ms);
+  c->printf("HTTP/1.1 200 OK\r\nContent-Type: text/xml; charset=\"utf-8\"\r\nServer: Stand-in UPnP/1.0\r\n"
+            "Content-Length: %u\r\nConnection: close\r\n\r\n", (unsigned)strlen(body));
+  c->print(body);
+}
+
+// answers GetSystemUpdateID as asked for by validateCache()
+void standInSystemUpdateIdReply(WiFiClient *c, bool keepAlive)
+{
+  char body[400];
+
+  snprintf(body, sizeof(body),
+    "<?xml version=\"1.0\" encoding=\"utf-8\"?>\r\n<s:Envelope xmlns:s=\"http://schemas.xmlsoap.org/soap/envelope/\" "
+    "s:encodingStyle=\"http://schemas.xmlsoap.org/soap/encoding/\"><s:Body>"
+    "<u:GetSystemUpdateIDResponse xmlns:u=\"" SSDP_SERVICE_TYPE_CD "\"><Id>%u</Id></u:GetSystemUpdateIDResponse>"
+    "</s:Body></s:Envelope>\r\n", (unsigned)standInSystemUpdateId);
+  c->printf("HTTP/1.1 200 OK\r\nContent-Type: text/xml; charset=\"utf-8\"\r\nServer: Stand-in UPnP/1.0\r\n"
+            "Content-Length: %u\r\n%s", (unsigned)strlen(body), 
+            keepAlive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n");
+  c->print(body);
+}
+
+// answers SUBSCRIBE (new subscription or renewal) & UNSUBSCRIBE
+void standInSubscription(WiFiClient *c, bool unsubscribe, const char *callback, const char *sid, unsigned timeout)
+{
+  if (unsubscribe || sid[0]) {
+    if (strcmp(sid, standInSid)) {
+      c->print("HTTP/1.1 412 Precondition Failed\r\nContent-Length: 0\r\nConnection: close\r\n\r\n");
+      return;
+    }
+    if (unsubscribe) standInSid[0] = 0;
+    else standInRenewals++;
+    if (!unsubscribe && standInRenewDelay) delay(standInRenewDelay);
+  }
+  else {
+    // new subscription, initial event follows
+    sscanf(callback, "<%79[^>]", standInCallback);
+    snprintf(standInSid, sizeof(standInSid), "uuid:stand-in-sub-%u", (unsigned)++standInSubscriptions);
+    standInNotifyPending = true;
+  }
+  c->printf("HTTP/1.1 200 OK\r\nServer: Stand-in UPnP/1.0\r\nSID: %s\r\nTIMEOUT: Second-%u\r\n"
+            "Content-Length: 0\r\nConnection: close\r\n\r\n", sid[0] ? sid : standInSid, timeout);
+}
+
+// handles a single request from the library, returns true if connection stays open
+bool standInHandle(WiFiClient *c)
+{
+  char line[200], objectId[60] = "", index[12] = "0", count[12] = "0", uri[60] = "", callback[80] = "", sid[40] = "";
+  size_t len, contentLength = 0;
+  uint32_t rangeFirst = 0, rangeLast = UINT32_MAX;
+  bool range = false;
+  unsigned timeout = 0;
+  bool post = false, head = false, search = false, keepAlive = false, sysUpdateId = false, gena = false, unsubscribe = false;
+  String body;
+
+  len = c->readBytesUntil('\n', line, sizeof(line) - 1);
+  line[len] = 0;
+  if (sscanf(line, "POST /%59s", uri) == 1) post = true;
+  else if (sscanf(line, "HEAD /%59s", uri) == 1) head = true;
+  else if (sscanf(line, "SUBSCRIBE /%59s", uri) == 1) gena = true;
+  else if (sscanf(line, "UNSUBSCRIBE /%59s", uri) == 1) gena = unsubscribe = true;
+  else if (sscanf(line, "GET /%59s", uri) != 1) return false;
+
+  // rest of HTTP header
+  while ((len = c->readBytesUntil('\n', line, sizeof(line) - 1)) > 1) {
+    line[len] = 0;
+    if (!strncasecmp(line, "Content-Length:", 15)) contentLength = atoi(line + 15);
+    if (strstr(line, "#Search")) search = true;
+    if (strstr(line, "#GetSystemUpdateID")) sysUpdateId = true;
+    if (!strncasecmp(line, "Connection: keep-alive", 22)) keepAlive = standInKeepAlive;
+    if (!strncasecmp(line, "CALLBACK: ", 10)) sscanf(line + 10, "%79s", callback);
+    if (!strncasecmp(line, "SID: ", 5)) sscanf(line + 5, "%39s", sid);
+    if (!strncasecmp(line, "TIMEOUT: Second-", 16)) timeout = atoi(line + 16);
+    if (!strncasecmp(line, "Range: bytes=", 13)) range = sscanf(line + 13, "%u-%u", &rangeFirst, &rangeLast) >= 1;
+  }
+  if (gena) {
+    standInSubscription(c, unsubscribe, callback, sid, timeout);
+    return false;
+  }
+  if (head) {
+    // restoreServerList() checks whether server is still there, no delay
+    c->print("HTTP/1.1 200 OK\r\nContent-Type: text/xml; charset=\"utf-8\"\r\nServer: Stand-in UPnP/1.0\r\n"
+             "Connection: close\r\n\r\n");
+    return false;
+  }
+  if (post) {
+    while (body.length() < contentLength) {
+      int ch = c->read();
+      if (ch < 0) {
+        if (!c->connected()) return false;
+        delay(1);
+        continue;
+      }
+      body += (char)ch;
+    }
+    standInRequestUs = micros();
+    if (sysUpdateId) {
+      standInSystemUpdateIdReply(c, keepAlive);
+      return keepAlive;
+    }
+    if (!standInGetTag(body, search ? "ContainerID" : "ObjectID", objectId, sizeof(objectId))) return false;
+    standInGetTag(body, "StartingIndex", index, sizeof(index));
+    standInGetTag(body, "RequestedCount", count, sizeof(count));
+  }
+  else {
+    strncpy(objectId, uri, sizeof(objectId));
+  }
+
+  unsigned size = 0, chunk = 0, stallMs = 0, stallKb = 0, rateKb = 0;
+  sscanf(objectId, "%*[a-z]/%u/%u/%u/%u/%u", &size, &chunk, &stallMs, &stallKb, &rateKb);
+  if (!strncmp(objectId, "desc/", 5)) {
+    standInDescription(c, objectId, size);
+    return false;
+  }
+  if (chunk > STANDIN_MAX_CHUNK) chunk = STANDIN_MAX_CHUNK;
+  if (post || strncmp(objectId, "file/", 5)) range = false;
+  if (range) {
+    if (rangeFirst >= size) {
+      c->printf("HTTP/1.1 416 Range Not Satisfiable\r\nContent-Range: bytes */%u\r\nContent-Length: 0\r\n"
+                "Connection: close\r\n\r\n", size);
+      return false;
+    }
+    if (rangeLast >= size) rangeLast = size - 1;
+  }
+  else {
+    rangeFirst = 0;
+    rangeLast = size - 1;
+  }
+
+  // first pass counts reply size, second pass sends it. Writer not on stack, connection tasks 
+  // of standInDescTask() have little of it
+  replyWriter_t *w = new replyWriter_t;
+  w->client = NULL;
+  w->chunkSize = chunk;
+  w->count = w->fill = 0;
+  if (post) standInBrowseBody(w, objectId, search, atoi(index), atoi(count));
+  else standInFileBody(w, rangeFirst, rangeLast - rangeFirst + 1);
+
+  String header = range ? "HTTP/1.1 206 Partial Content\r\n" : "HTTP/1.1 200 OK\r\n";
+  if (range) header += String("Content-Range: bytes ") + rangeFirst + "-" + rangeLast + "/" + size + "\r\n";
+  header += post ? "Content-Type: text/xml; charset=\"utf-8\"\r\n" : "Content-Type: audio/mpeg\r\n";
+  header += "Server: Stand-in UPnP/1.0\r\n";
+  if (chunk) header += "Transfer-Encoding: chunked\r\n";
+  else header += String("Content-Length: ") + (unsigned long)w->count + "\r\n";
+  header += keepAlive ? "Connection: keep-alive\r\n\r\n" : "Connection: close\r\n\r\n";
+  standInReplySize = header.length() + w->count;
+
+  c->print(header);
+  w->client = c;
+  w->count = 0;
+  if (post) standInBrowseBody(w, objectId, search, atoi(index), atoi(count));
+  else standInFileBody(w, rangeFirst, rangeLast - rangeFirst + 1, stallMs, stallKb * 1024, rateKb);
+  writerFinish(w);
+  delete w;
+
+  return keepAlive;
+}
+
+void standInTask(void *parameter)
+{
+  WiFiServer *server = (WiFiServer *)parameter;
+
+  while (true) {
+    WiFiClient c = server->available();
+    if (c) {
+      while (standInHandle(&c)) {
+        // wait for next request on kept-alive connection
+        uint32_t start = millis();
+        while (!c.available() && c.connected() && millis() - start < STANDIN_KEEP_ALIVE_MS) delay(1);
+        if (!c.available()) break;
+      }
+      c.stop();
+    }
+    else {
+      delay(1);
+    }
+  }
+}
+
+// sends event messages to subscriber, the first one after subscribing carries no changed containers
+void standInNotifyTask(void *parameter)
+{
+  uint32_t seq = 0, subscription = 0;
+  char body[400], containers[80] = "", host[20];
+  unsigned port = 0;
+  IPAddress ip;
+
+  while (true) {
+    delay(1);
+    if (!standInNotifyPending || !standInSid[0]) continue;
+    standInNotifyPending = false;
+    if (subscription != standInSubscriptions) {
+      subscription = standInSubscriptions;
+      seq = 0;
+    }
+    if (seq) snprintf(containers, sizeof(containers), "%s,%u", CACHE_OBJECT_ID, (unsigned)standInContainerUpdateId);
+    snprintf(body, sizeof(body),
+      "<?xml version=\"1.0\"?>\r\n<e:propertyset xmlns:e=\"urn:schemas-upnp-org:event-1-0\">"
+      "<e:property><SystemUpdateID>%u</SystemUpdateID></e:property>"
+      "<e:property><ContainerUpdateIDs>%s</ContainerUpdateIDs></e:property></e:propertyset>\r\n",
+      (unsigned)standInSystemUpdateId, seq ? containers : "");
+
+    WiFiClient c;
+    if (sscanf(standInCallback, "http://%19[0-9.]:%u", host, &port) != 2 || !ip.fromString(host) || !c.connect(ip, port)) {
+      Serial.println("stand-in server: event subscriber not reachable");
+      continue;
+    }
+    c.printf("NOTIFY /%s HTTP/1.1\r\nHOST: %s:%u\r\nCONTENT-TYPE: text/xml; charset=\"utf-8\"\r\n"
+             "CONTENT-LENGTH: %u\r\nNT: upnp:event\r\nNTS: upnp:propchange\r\nSID: %s\r\nSEQ: %u\r\n\r\n",
+             strchr(standInCallback + 7, '/') + 1, host, port, (unsigned)strlen(body), standInSid, (unsigned)seq++);
+    if (standInNotifyStall) delay(standInNotifyStall);
+    c.print(body);
+    // library replies from poll()
+    uint32_t start = millis();
+    while (!c.available() && c.connected() && millis() - start < EVENT_WAIT) delay(1);
+    c.stop();
+  }
+}
+
+// announces all stand-in description servers via SSDP NOTIFY (sent to our own IP address)
+void standInAnnounceTask(void *parameter)
+{
+  WiFiUDP notify;
+  char packet[400];
+  uint32_t last = 0, round = 0;
+
+  while (true) {
+    delay(10);
+    // announce right away with each new seek, then regularly
+    if (standInAnnounce && (round != standInAnnounceRound || millis() - last >= DESC_NOTIFY_INTERVAL)) {
+      round = standInAnnounceRound;
+      last = millis();
+      for (int i = 0; i < DESC_SERVERS; i++) {
+        snprintf(packet, sizeof(packet),
+          SSDP_NOTIFICATION "\r\nHOST: 239.255.255.250:1900\r\nCACHE-CONTROL: max-age=1800\r\n"
+          "LOCATION: http://%s:%d/desc/%u\r\nNT: " SSDP_DEVICE_TYPE_MS "\r\nNTS: " SSDP_NOTIFICATION_SUB_TYPE "\r\n"
+          "SERVER: Stand-in UPnP/1.0\r\nUSN: uuid:stand-in-%u::" SSDP_DEVICE_TYPE_MS "\r\n\r\n",
+          WiFi.localIP().toString().c_str(), DESC_PORT + i, (unsigned)descDelays[i], (unsigned)descDelays[i]);
+        notify.beginPacket(WiFi.localIP(), SSDP_MULTICAST_PORT);
+        notify.write((const uint8_t *)packet, strlen(packet));
+        notify.endPacket();
+      }
+    }
+  }
+}
+
+// handles a single request to a stand-in description server
+void standInConnectionTask(void *parameter)
+{
+  WiFiClient *c = (WiFiClient *)parameter;
+
+  standInHandle(c);
+  c->stop();
+  delete c;
+  vTaskDelete(NULL);
+}
+
+// stand-in description server (also used for segmented downloads), unlike standInTask() each connection
+// is handled by a separate task so a delayed reply does not hold up the next seek
+void standInDescTask(void *parameter)
+{
+  WiFiServer *server = (WiFiServer *)parameter;
+
+  while (true) {
+    WiFiClient c = server->available();
+    if (c) {
+      xTaskCreate(standInConnectionTask, "standInCon", 4096, new WiFiClient(c), 1, NULL);
+    }
+    else {
+      delay(1);
+    }
+  }
+}
+
+//
+// Benchmarks
+//
+
+// objects: total number of objects of all runs, bytes: total number of bytes of all runs
+void printResult(const char *name, unsigned objects, unsigned runs, uint64_t bytes, uint32_t ms, uint32_t ttfo)
+{
+  if (!ms) ms = 1;
+  Serial.printf("%-30s %8u %10.1f %10.1f %8u\n", name, objects / runs,
+                objects * 1000.0 / ms, bytes / 1.024 / ms, ttfo);
+}
+
+// called by browseServer()/searchServer() for each object as soon as it has been scanned
+bool countObject(const soapObject_t *object, void *arg)
+{
+  callbackRun_t *run = (callbackRun_t *)arg;
+
+  if (run->objects++ == 0) run->first = millis() - run->start;
+  return true;
+}
+
+void benchBrowse(const scenario_t *s)
+{
+  soapObjectVect_t result;
+  callbackRun_t run;
+  unsigned objects = 0;
+  uint64_t bytes = 0;
+  uint32_t total = 0, ttfo = UINT32_MAX;
+
+  // throughput with result list
+  for (int i = 0; i < BENCH_REPEATS; i++) {
+    uint32_t start = millis();
+    bool ok = s->search ?
+              soap.searchServer(0, s->objectId, &result, SOAP_SEARCH_CRITERIA_TITLE, "Track") :
+              soap.browseServer(0, s->objectId, &result);
+    uint32_t elapsed = millis() - start;
+
+    if (!ok || result.size() != s->expected) {
+      Serial.printf("%-30s FAILED (returned %s, objects %u, expected %u)\n",
+                    s->name, ok ? "true" : "false", (unsigned)result.size(), s->expected);
+      return;
+    }
+    total += elapsed;
+    objects += result.size();
+    bytes += standInReplySize;
+  }
+  // time-to-first-object with callback, objects get reported while the reply is still coming in
+  for (int i = 0; i < BENCH_REPEATS; i++) {
+    run.objects = 0;
+    run.first = 0;
+    run.start = millis();
+    bool ok = s->search ?
+              soap.searchServer(0, s->objectId, countObject, &run, SOAP_SEARCH_CRITERIA_TITLE, "Track") :
+              soap.browseServer(0, s->objectId, countObject, &run);
+    if (!ok || run.objects != s->expected) {
+      Serial.printf("%-30s FAILED (callback, returned %s, objects %u, expected %u)\n",
+                    s->name, ok ? "true" : "false", run.objects, s->expected);
+      return;
+    }
+    if (run.first < ttfo) ttfo = run.first;
+  }
+  printResult(s->name, objects, BENCH_REPEATS, bytes, total, ttfo);
+}
+
+void benchDownload(const download_t *d)
+{
+  static uint8_t buffer[READ_BUFFER_SIZE];
+  soapObject_t object;
+  uint64_t bytes = 0;
+  uint32_t total = 0, ttfo = UINT32_MAX;
+  size_t size;
+
+  object.isDirectory = false;
+  object.size = 0;
+  sscanf(d->uri, "file/%llu", &object.size);       // chunked replies come without size
+  object.downloadIp = WiFi.localIP();
+  object.downloadPort = STANDIN_PORT;
+  object.uri = d->uri;
+  for (int i = 0; i < BENCH_REPEATS; i++) {
+    uint32_t start = millis(), first = 0;
+    if (!soap.readStart(&object, &size)) {
+      Serial.printf("%-30s FAILED (readStart)\n", d->name);
+      return;
+    }
+    while (soap.available()) {
+      int res = soap.read(buffer, sizeof(buffer));
+      if (res <= 0) break;
+      if (!first) first = millis() - start;
+      bytes += res;
+    }
+    soap.readStop();
+    total += millis() - start;
+    if (first < ttfo) ttfo = first;
+  }
+  printResult(d->name, 0, BENCH_REPEATS, bytes, total, ttfo);
+}
+
+// simulated decoder reading STREAM_BLOCK bytes at STREAM_RATE from a download with stalls, 
+// read-ahead buffer of given size (0: read directly)
+void benchStream(const download_t *d, const char *name, size_t readAhead)
+{
+  static uint8_t buffer[STREAM_BLOCK];
+  soapObject_t object;
+  soapReadAheadStats_t stats;
+  uint64_t bytes = 0;
+  uint32_t slowest = 0, late = 0, period = STREAM_BLOCK * 1000000ULL / (STREAM_RATE * 1024);
+  size_t size;
+
+  object.isDirectory = false;
+  object.size = 0;
+  sscanf(d->uri, "file/%llu", &object.size);
+  object.downloadIp = WiFi.localIP();
+  object.downloadPort = STANDIN_PORT;
+  object.uri = d->uri;
+  if (!soap.setReadAhead(readAhead)) {
+    Serial.printf("%-30s FAILED (setReadAhead)\n", name);
+    return;
+  }
+  uint32_t start = millis();
+  if (!soap.readStart(&object, &size)) {
+    Serial.printf("%-30s FAILED (readStart)\n", name);
+    return;
+  }
+  uint32_t next = micros();
+  while (soap.available()) {
+    // decoder wants the next block
+    while ((int32_t)(next - micros()) > 0) delay(1);
+    uint32_t t = micros();
+    size_t got = 0;
+    while (got < sizeof(buffer) && soap.available()) {
+      int res = soap.read(buffer + got, sizeof(buffer) - got);
+      if (res <= 0) break;
+      got += res;
+    }
+    t = micros() - t;
+    if (!got) break;
+    if (t > slowest) slowest = t;
+    if (t > STREAM_LATE_MS * 1000) late++;
+    bytes += got;
+    next += period;
+  }
+  soap.getReadAheadStats(&stats);
+  soap.readStop();
+  uint32_t total = millis() - start;
+  soap.setReadAhead(0);
+  if (bytes != object.size) {
+    Serial.printf("%-30s FAILED (%llu of %llu bytes)\n", name, bytes, object.size);
+    return;
+  }
+  Serial.printf("%-30s %8.1f %8.1f %8u", name, bytes / 1.024 / total, slowest / 1000.0, late);
+  if (readAhead) Serial.printf(" %8u %8.1f\n", stats.underruns, stats.minFill / 1024.0);
+  else Serial.printf(" %8s %8s\n", "-", "-");
+}
+
+// download read in blocks of READ_BUFFER_SIZE, returns kbytes/s (0 in case of error)
+float benchDechunk(const download_t *d)
+{
+  static uint8_t buffer[READ_BUFFER_SIZE];
+  soapObject_t object;
+  uint64_t bytes = 0;
+  uint32_t us = 0;
+  size_t size;
+
+  object.isDirectory = false;
+  sscanf(d->uri, "file/%llu", &object.size);
+  object.downloadIp = WiFi.localIP();
+  object.downloadPort = STANDIN_PORT;
+  object.uri = d->uri;
+  for (int i = 0; i < BENCH_REPEATS; i++) {
+    uint32_t start = micros();
+    if (!soap.readStart(&object, &size)) return 0;
+    while (soap.available()) {
+      int res = soap.read(buffer, sizeof(buffer));
+      if (res <= 0) break;
+      bytes += res;
+    }
+    soap.readStop();
+    us += micros() - start;
+  }
+  if (bytes != object.size * BENCH_REPEATS) return 0;
+
+  return bytes * 1000.0 / 1.024 / (us ? us : 1);
+}
+
+// de-chunking throughput relative to a download not chunked
+void benchChunked()
+{
+  float reference = 0;
+
+  for (int ext = 0; ext < 2; ext++) {
+    standInChunkExt = ext;
+    for (int i = ext; i < sizeof(chunkings) / sizeof(download_t); i++) {
+      String name = String(chunkings[i].name) + (ext ? " + ext" : "");
+      float kbs = benchDechunk(&chunkings[i]);
+      if (!kbs) {
+        Serial.printf("%-30s FAILED\n", name.c_str());
+        continue;
+      }
+      if (!i) reference = kbs;
+      Serial.printf("%-30s %10.1f %8.0f\n", name.c_str(), kbs, reference ? kbs * 100 / reference : 0);
+    }
+  }
+  standInChunkExt = false;
+}
+
+// reads a download until given number of bytes has been received, checks content. Returns ms 
+// needed incl. readStart(), 0 in case of error
+uint32_t readRange(const char *uri, uint32_t offset, uint32_t length, uint32_t skip, soapRange_t *range)
+{
+  static uint8_t buffer[READ_BUFFER_SIZE];
+  soapObject_t object;
+  uint32_t start = millis(), pos = offset, end = offset + skip + length;
+  size_t size;
+
+  object.isDirectory = false;
+  object.size = 0;
+  object.downloadIp = WiFi.localIP();
+  object.downloadPort = STANDIN_PORT;
+  object.uri = uri;
+  if (offset) {
+    if (!soap.readStart(&object, offset, length, range)) return 0;
+  }
+  else {
+    if (!soap.readStart(&object, &size)) return 0;
+  }
+  while (pos < end && soap.available()) {
+    int res = soap.read(buffer, min((uint32_t)sizeof(buffer), end - pos));
+    if (res <= 0) break;
+    for (int i = 0; i < res; i++) {
+      if (buffer[i] != standInFileByte(pos + i)) {
+        soap.readStop();
+        return 0;
+      }
+    }
+    pos += res;
+  }
+  soap.readStop();
+
+  return (pos == end) ? millis() - start : 0;
+}
+
+// seeking within a file: range request compared to reading up to the seek position, server 
+// without range support & seek position beyond end of file
+void benchRange()
+{
+  char uri[40];
+  soapRange_t range;
+  const char *status[] = { "error", "partial", "full", "ignored", "not satisfiable" };
+  uint32_t ms;
+
+  snprintf(uri, sizeof(uri), "file/%u/0", RANGE_FILE_SIZE);
+  ms = readRange(uri, 0, RANGE_LENGTH, RANGE_OFFSET, &range);
+  Serial.printf("%-30s %8u %8u\n", "read up to seek position", (RANGE_OFFSET + RANGE_LENGTH) / 1024, ms);
+  ms = readRange(uri, RANGE_OFFSET, RANGE_LENGTH, 0, &range);
+  Serial.printf("%-30s %8u %8u %s\n", "range request", RANGE_LENGTH / 1024, ms, status[range.status]);
+  snprintf(uri, sizeof(uri), "file/%u/1460", RANGE_FILE_SIZE);
+  ms = readRange(uri, RANGE_OFFSET, RANGE_LENGTH, 0, &range);
+  Serial.printf("%-30s %8u %8u %s\n", "range request, chunked", RANGE_LENGTH / 1024, ms, status[range.status]);
+  snprintf(uri, sizeof(uri), "norange/%u/0", RANGE_FILE_SIZE);
+  ms = readRange(uri, RANGE_OFFSET, RANGE_LENGTH, 0, &range);
+  Serial.printf("%-30s %8s %8u %s\n", "server without ranges", "-", ms, status[range.status]);
+  snprintf(uri, sizeof(uri), "file/%u/0", RANGE_FILE_SIZE);
+  ms = readRange(uri, RANGE_FILE_SIZE, RANGE_LENGTH, 0, &range);
+  Serial.printf("%-30s %8s %8u %s\n", "beyond end of file", "-", ms, status[range.status]);
+}
+
+void getHeapStats(heapStats_t *h)
+{
+  multi_heap_info_t info;
+
+  heap_caps_get_info(&info, MALLOC_CAP_8BIT);
+  h->freeBytes = info.total_free_bytes;
+  h->largestBlock = info.largest_free_block;
+  h->blocks = info.allocated_blocks;
+}
+
+void startPeakMonitor()
+{
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+  heap_caps_monitor_local_minimum_free_size_start();
+#endif
+}
+
+// returns lowest free heap since startPeakMonitor(), 0 if not supported
+size_t stopPeakMonitor()
+{
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+  size_t minFree = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+  heap_caps_monitor_local_minimum_free_size_stop();
+  return minFree;
+#else
+  return 0;
+#endif
+}
+
+void printMemResult(const char *name, const heapStats_t *before, const heapStats_t *after, size_t minFree)
+{
+  Serial.printf("%-30s %8d %10.1f ", name, (int)(after->blocks - before->blocks),
+                ((int)before->freeBytes - (int)after->freeBytes) / 1024.0);
+  if (minFree)
+    Serial.printf("%10.1f", ((int)before->freeBytes - (int)minFree) / 1024.0);
+  else
+    Serial.printf("%10s", "n/a");
+  Serial.printf(" %10.1f\n", after->largestBlock / 1024.0);
+}
+
+// browse MEM_PAGES pages, each one replacing the previous one like a player's directory view does
+void benchMemory()
+{
+  heapStats_t before, after;
+  size_t minFree;
+  bool ok = true;
+
+  {
+    soapObjectVect_t result;
+    getHeapStats(&before);
+    startPeakMonitor();
+    for (int i = 0; i < MEM_PAGES; i++) ok &= soap.browseServer(0, MEM_OBJECT_ID, &result);
+    minFree = stopPeakMonitor();
+    getHeapStats(&after);
+    if (ok) printMemResult("soapObjectVect_t", &before, &after, minFree);
+    else Serial.printf("%-30s FAILED\n", "soapObjectVect_t");
+  }
+  {
+    SoapResultSet result;
+    getHeapStats(&before);
+    startPeakMonitor();
+    for (int i = 0; i < MEM_PAGES; i++) ok &= soap.browseServer(0, MEM_OBJECT_ID, &result);
+    minFree = stopPeakMonitor();
+    getHeapStats(&after);
+    if (ok) printMemResult("SoapResultSet", &before, &after, minFree);
+    else Serial.printf("%-30s FAILED\n", "SoapResultSet");
+  }
+}
+
+// browse SEQ_BROWSES times in a row, connection setup dominates with small replies
+void benchSequential(const char *name, bool keepAlive, bool serverKeepAlive)
+{
+  soapObjectVect_t result;
+  unsigned objects = 0;
+  uint64_t bytes = 0;
+  uint32_t start, elapsed, total = 0, fastest = UINT32_MAX;
+
+  soap.setKeepAlive(keepAlive);
+  standInKeepAlive = serverKeepAlive;
+  for (int i = 0; i < SEQ_BROWSES; i++) {
+    start = millis();
+    if (!soap.browseServer(0, SEQ_OBJECT_ID, &result)) {
+      Serial.printf("%-30s FAILED (browse %d)\n", name, i);
+      break;
+    }
+    elapsed = millis() - start;
+    if (elapsed < fastest) fastest = elapsed;
+    total += elapsed;
+    objects += result.size();
+    bytes += standInReplySize;
+  }
+  soap.setKeepAlive(true);
+  standInKeepAlive = true;
+  printResult(name, objects, SEQ_BROWSES, bytes, total, fastest);
+}
+
+// progress of asynchronous browses/seeking, result -1 while in progress
+struct asyncRun_t
+{
+  unsigned int count;
+  int result;
+};
+
+// called by poll() for each object of an asynchronous browse
+bool countObjectAsync(const soapObject_t *object, void *arg)
+{
+  ((asyncRun_t *)arg)->count++;
+  return true;
+}
+
+// called by poll() when an asynchronous browse has finished
+void asyncDone(bool ok, const soapPageInfo_t *page, void *arg)
+{
+  ((asyncRun_t *)arg)->result = ok ? 1 : 0;
+}
+
+// poll() until asynchronous browse/seeking has finished, returns longest poll() in us
+uint32_t pollUntilDone(void)
+{
+  uint32_t longest = 0;
+
+  while (true) {
+    uint32_t start = micros();
+    bool busy = soap.poll();
+    uint32_t elapsed = micros() - start;
+    if (elapsed > longest) longest = elapsed;
+    if (!busy) break;
+  }
+
+  return longest;
+}
+
+// browse SEQ_BROWSES times in a row with browseServerAsync(), the longest poll() shows whether
+// connecting to the server or evaluating the reply blocks
+void benchAsync(const char *name, bool keepAlive)
+{
+  asyncRun_t run = { 0, 1 };
+  uint32_t longest = 0, start = millis();
+
+  soap.setKeepAlive(keepAlive);
+  for (int i = 0; i < SEQ_BROWSES && run.result == 1; i++) {
+    run.result = -1;
+    if (!soap.browseServerAsync(0, SEQ_OBJECT_ID, countObjectAsync, asyncDone, &run)) break;
+    uint32_t elapsed = pollUntilDone();
+    if (elapsed > longest) longest = elapsed;
+  }
+  uint32_t elapsed = millis() - start;
+  soap.setKeepAlive(true);
+
+  if (run.result != 1) {
+    Serial.printf("%-30s FAILED\n", name);
+    return;
+  }
+  Serial.printf("%-30s %8u %8u %8u\n", name, run.count / SEQ_BROWSES, elapsed, longest);
+}
+
+// time from calling browseServer()/searchServer() until stand-in server has received the request: 
+// assembling & sending the request on a kept-alive connection
+void benchRequest(const char *name, bool search)
+{
+  soapObjectVect_t result;
+  uint32_t start, elapsed, total = 0, fastest = UINT32_MAX;
+
+  for (int i = 0; i < SEQ_BROWSES; i++) {
+    start = micros();
+    bool ok = search ?
+              soap.searchServer(0, REQ_OBJECT_ID, &result, SOAP_SEARCH_CRITERIA_TITLE, "Rock & Roll",
+                                SOAP_SEARCH_CRITERIA_ARTIST, "Some Artist", SOAP_SORT_TITLE_ASCENDING) :
+              soap.browseServer(0, REQ_OBJECT_ID, &result);
+    if (!ok) {
+      Serial.printf("%-30s FAILED (request %d)\n", name, i);
+      return;
+    }
+    elapsed = standInRequestUs - start;
+    if (i == 0) continue;                      // first one might set up the connection
+    if (elapsed < fastest) fastest = elapsed;
+    total += elapsed;
+  }
+  Serial.printf("%-30s %8u %8u\n", name, total / (SEQ_BROWSES - 1), fastest);
+}
+
+// browse the same page CACHE_BROWSES times with result cache enabled, only the first browse
+// is sent to the stand-in server
+void benchCache(const char *name, int resultType)      // 0: soapObjectVect_t, 1: SoapResultSet, 2: callback
+{
+  soapObjectVect_t vect;
+  SoapResultSet set;
+  callbackRun_t run;
+  soapCacheStats_t stats;
+  uint32_t start, elapsed, miss = 0, total = 0, fastest = UINT32_MAX;
+  size_t objects;
+
+  soap.clearCache();
+  for (int i = 0; i < CACHE_BROWSES; i++) {
+    run.objects = 0;
+    run.start = millis();
+    start = micros();
+    bool ok = (resultType == 0) ? soap.browseServer(0, CACHE_OBJECT_ID, &vect) :
+              (resultType == 1) ? soap.browseServer(0, CACHE_OBJECT_ID, &set) :
+                                  soap.browseServer(0, CACHE_OBJECT_ID, countObject, &run);
+    elapsed = micros() - start;
+    objects = (resultType == 0) ? vect.size() : (resultType == 1) ? set.size() : run.objects;
+    if (!ok || objects != 100) {
+      Serial.printf("%-30s FAILED (browse %d, objects %u)\n", name, i, (unsigned)objects);
+      return;
+    }
+    if (i == 0) {
+      miss = elapsed;
+      continue;
+    }
+    if (elapsed < fastest) fastest = elapsed;
+    total += elapsed;
+  }
+  soap.getCacheStats(&stats);
+  if (stats.hits != CACHE_BROWSES - 1 || stats.misses != 1) {
+    Serial.printf("%-30s FAILED (hits %u, misses %u)\n", name, stats.hits, stats.misses);
+    return;
+  }
+  Serial.printf("%-30s %8u %8u %8u %8.1f\n", name, miss, total / (CACHE_BROWSES - 1), fastest, stats.memory / 1024.0);
+}
+
+// validateCache() after content of stand-in server has changed, next browse is sent to server again
+void benchCacheValidate(const char *name)
+{
+  soapObjectVect_t result;
+  soapCacheStats_t stats;
+
+  soap.clearCache();
+  bool ok = soap.browseServer(0, CACHE_OBJECT_ID, &result) && soap.validateCache(0);
+  standInSystemUpdateId++;
+  uint32_t start = micros();
+  ok &= soap.validateCache(0);
+  uint32_t elapsed = micros() - start;
+  ok &= soap.browseServer(0, CACHE_OBJECT_ID, &result);
+  soap.getCacheStats(&stats);
+  if (!ok || stats.invalidated != 1 || stats.misses != 2) {
+    Serial.printf("%-30s FAILED (invalidated %u, misses %u)\n", name, stats.invalidated, stats.misses);
+    return;
+  }
+  Serial.printf("%-30s %8u %8s %8s %8.1f\n", name, elapsed, "-", "-", stats.memory / 1024.0);
+}
+
+// called by poll() for each event received
+void countEvent(const soapEvent_t *event, void *arg)
+{
+  eventRun_t *run = (eventRun_t *)arg;
+
+  run->events++;
+  run->containers = event->containers.size();
+}
+
+// poll() until given number of events has been received, returns us needed or 0 in case of timeout.
+// Optionally the longest poll() in us is returned as well
+uint32_t waitForEvents(const eventRun_t *run, unsigned events, uint32_t *longest = NULL)
+{
+  uint32_t start = micros();
+
+  while (run->events < events) {
+    if (micros() - start > EVENT_WAIT * 1000) return 0;
+    uint32_t t = micros();
+    soap.poll();
+    if (longest && micros() - t > *longest) *longest = micros() - t;
+  }
+  return micros() - start;
+}
+
+// event subscription with the stand-in server: subscribing, initial event, a changed directory 
+// dropped from cache by an event, an event with late body, renewals of a short subscription answered
+// late and cancelling the subscription
+void benchEvents()
+{
+  static WiFiServer listener(EVENT_PORT);
+  eventRun_t run = { 0, 0 };
+  soapObjectVect_t result;
+  soapCacheStats_t stats;
+  uint32_t start, elapsed;
+
+  soap.setEventListener(&listener, EVENT_PORT, countEvent, &run);
+  soap.setCache(SOAP_CACHE_DEFAULT_SIZE);
+  soap.clearCache();
+
+  start = micros();
+  bool ok = soap.subscribeEvents(0, EVENT_TIMEOUT);
+  elapsed = micros() - start;
+  if (!ok) {
+    Serial.printf("%-30s FAILED\n", "subscribe");
+    return;
+  }
+  Serial.printf("%-30s %8u\n", "subscribe", elapsed);
+  if (!(elapsed = waitForEvents(&run, 1))) {
+    Serial.printf("%-30s FAILED (no event)\n", "initial event");
+    return;
+  }
+  Serial.printf("%-30s %8u\n", "initial event", elapsed);
+
+  // directory cached, then changed at server
+  ok = soap.browseServer(0, CACHE_OBJECT_ID, &result) && soap.browseServer(0, CACHE_OBJECT_ID, &result);
+  standInContainerUpdateId++;
+  standInSystemUpdateId++;
+  standInNotifyPending = true;
+  elapsed = waitForEvents(&run, 2);
+  soap.getCacheStats(&stats);
+  if (!ok || !elapsed || run.containers != 1 || stats.invalidated != 1 || stats.entries != 0) {
+    Serial.printf("%-30s FAILED (containers %u, invalidated %u)\n", "change, cache dropped", run.containers, stats.invalidated);
+    return;
+  }
+  Serial.printf("%-30s %8u\n", "change, cache dropped", elapsed);
+
+  // event message whose body comes late, poll() doesn't wait for it
+  uint32_t longest = 0;
+  char name[32];
+  snprintf(name, sizeof(name), "body %u ms late", EVENT_STALL);
+  standInNotifyStall = EVENT_STALL;
+  standInNotifyPending = true;
+  elapsed = waitForEvents(&run, 3, &longest);
+  standInNotifyStall = 0;
+  if (!elapsed) {
+    Serial.printf("%-30s FAILED\n", name);
+    return;
+  }
+  Serial.printf("%-30s %8u longest poll() %u us\n", name, elapsed, longest);
+
+  // poll() renews subscription 2 s before it expires, server answers late
+  uint32_t renewals = standInRenewals;
+  longest = 0;
+  standInRenewDelay = EVENT_STALL;
+  start = millis();
+  while (millis() - start < EVENT_RENEW_WAIT) {
+    uint32_t t = micros();
+    soap.poll();
+    if (micros() - t > longest) longest = micros() - t;
+  }
+  standInRenewDelay = 0;
+  Serial.printf("%-30s %8u renewals (%u ms late), longest poll() %u us\n", "within 5 s, subscribed 4 s", 
+                (unsigned)(standInRenewals - renewals), EVENT_STALL, longest);
+
+  start = micros();
+  ok = soap.unsubscribeEvents(0);
+  elapsed = micros() - start;
+  if (!ok || standInSid[0]) {
+    Serial.printf("%-30s FAILED\n", "unsubscribe");
+    return;
+  }
+  Serial.printf("%-30s %8u\n", "unsubscribe", elapsed);
+  soap.setCache(0);
+}
+
+// seekServer() with the stand-in description servers, time of description part is printed
+void benchSeek(const char *name, unsigned int maxParallel)
+{
+  soap.setSeekConcurrency(maxParallel);
+  standInAnnounceRound++;
+  standInAnnounce = true;
+  uint32_t start = millis();
+  unsigned int found = soap.seekServer(DESC_SCAN_DURATION);
+  uint32_t elapsed = millis() - start;
+  standInAnnounce = false;
+  soap.setSeekConcurrency(SSDP_DESCRIPTION_PARALLEL);
+
+  if (found != DESC_SERVERS - 1) {
+    Serial.printf("%-30s FAILED (found %u servers, expected %u)\n", name, found, (unsigned)DESC_SERVERS - 1);
+    return;
+  }
+  Serial.printf("%-30s %8u %8u\n", name, found, elapsed - DESC_SCAN_DURATION * 1000);
+}
+
+// called by seekServerUntil() for each server delivering content
+bool countServer(const soapServer_t *server, void *arg)
+{
+  (*(unsigned int *)arg)++;
+  return true;
+}
+
+// seekServerUntil() with the stand-in description servers, total time is printed
+void benchSeekUntil(const char *name, const soapSeekUntil_t *until, unsigned int expected)
+{
+  unsigned int reported = 0;
+
+  standInAnnounceRound++;
+  standInAnnounce = true;
+  uint32_t start = millis();
+  unsigned int found = soap.seekServerUntil(until, countServer, &reported, DESC_SCAN_DURATION);
+  uint32_t elapsed = millis() - start;
+  standInAnnounce = false;
+
+  if (found != expected || reported != found) {
+    Serial.printf("%-30s FAILED (found %u servers, reported %u, expected %u)\n", name, found, reported, expected);
+    return;
+  }
+  Serial.printf("%-30s %8u %8u\n", name, found, elapsed);
+}
+
+// called by poll() for each server delivering content found by seekServerAsync()
+bool countServerAsync(const soapServer_t *server, void *arg)
+{
+  ((asyncRun_t *)arg)->count++;
+  return true;
+}
+
+// called by poll() when seekServerAsync() has finished
+void seekDone(unsigned int servers, void *arg)
+{
+  ((asyncRun_t *)arg)->result = servers;
+}
+
+// seekServerAsync() with the stand-in description servers, total time & longest poll() are printed
+void benchSeekAsync(const char *name, const soapSeekUntil_t *until, unsigned int expected)
+{
+  asyncRun_t run = { 0, -1 };
+  uint32_t longest = 0;
+
+  standInAnnounceRound++;
+  standInAnnounce = true;
+  uint32_t start = millis();
+  if (soap.seekServerAsync(until, countServerAsync, seekDone, &run, DESC_SCAN_DURATION)) longest = pollUntilDone();
+  uint32_t elapsed = millis() - start;
+  standInAnnounce = false;
+
+  if (run.result != (int)expected || run.count != expected) {
+    Serial.printf("%-30s FAILED (found %d servers, reported %u, expected %u)\n", name, run.result, run.count, expected);
+    return;
+  }
+  Serial.printf("%-30s %8u %8u %8u\n", name, run.count, elapsed, longest);
+}
+
+// restoreServerList() with a saved server list, total time is printed
+void benchRestore(const char *name, const String &list, unsigned int expected)
+{
+  StreamString stream;
+
+  stream.print(list);
+  standInAnnounceRound++;                    // in case of full scan
+  standInAnnounce = true;
+  uint32_t start = millis();
+  unsigned int found = soap.restoreServerList(&stream, DESC_SCAN_DURATION);
+  uint32_t elapsed = millis() - start;
+  standInAnnounce = false;
+
+  if (found != expected) {
+    Serial.printf("%-30s FAILED (found %u servers, expected %u)\n", name, found, expected);
+    return;
+  }
+  Serial.printf("%-30s %8u %8u\n", name, found, elapsed);
+}
+
+// sink of readTo(), adds up all bytes
+bool addBytes(const uint8_t *data, size_t size, void *arg)
+{
+  uint32_t *sum = (uint32_t *)arg;
+
+  for (size_t i = 0; i < size; i++) *sum += data[i];
+
+  return true;
+}
+
+// download handed to a checksum: read() into a buffer of the sketch or readTo() handing out spans of
+// the library's receive/read-ahead buffer
+void benchSink(const char *name, bool sink, size_t readAhead)
+{
+  static uint8_t buffer[READ_BUFFER_SIZE];
+  soapObject_t object;
+  uint64_t bytes = 0;
+  uint32_t total = 0, sum = 0, expected = 0;
+  size_t size;
+
+  object.isDirectory = false;
+  sscanf(SINK_URI, "file/%llu", &object.size);
+  object.downloadIp = WiFi.localIP();
+  object.downloadPort = STANDIN_PORT;
+  object.uri = SINK_URI;
+  for (uint32_t pos = 0; pos < object.size; pos++) expected += standInFileByte(pos);
+  soap.setReadAhead(readAhead);
+  for (int i = 0; i < BENCH_REPEATS; i++) {
+    uint32_t start = millis();
+    uint64_t n = 0;
+    sum = 0;
+    if (!soap.readStart(&object, &size)) break;
+    if (sink) {
+      soap.readTo(addBytes, &sum, &n);
+    }
+    else {
+      while (soap.available()) {
+        int res = soap.read(buffer, sizeof(buffer));
+        if (res <= 0) break;
+        addBytes(buffer, res, &sum);
+        n += res;
+      }
+    }
+    soap.readStop();
+    total += millis() - start;
+    bytes += n;
+    if (n != object.size || sum != expected) break;
+  }
+  soap.setReadAhead(0);
+  if (bytes != object.size * BENCH_REPEATS || sum != expected) {
+    Serial.printf("%-30s FAILED (%llu bytes, checksum %s)\n", name, bytes, sum == expected ? "ok" : "wrong");
+    return;
+  }
+  Serial.printf("%-30s %8.1f %8u\n", name, bytes / 1.024 / total, sink ? 0 : READ_BUFFER_SIZE);
+}
+
+// bookkeeping of a segmented download
+struct segmentRun_t {
+  uint64_t bytes;                // bytes handed to sink so far
+  bool     valid;                // false: sink got unexpected content
+};
+
+// sink of segmented download, checks content
+bool checkSegment(const uint8_t *data, size_t size, void *arg)
+{
+  segmentRun_t *run = (segmentRun_t *)arg;
+
+  for (size_t i = 0; i < size && run->valid; i++) {
+    if (data[i] != standInFileByte(run->bytes + i)) run->valid = false;
+  }
+  run->bytes += size;
+
+  return run->valid;
+}
+
+// downloads a file limited to SEGMENT_RATE kB/s per connection over several connections at once
+void benchSegmented(const char *name, const char *profile, unsigned int connections, size_t segmentSize)
+{
+  char uri[60];
+  soapObject_t object;
+  segmentRun_t run = { .bytes = 0, .valid = true };
+
+  snprintf(uri, sizeof(uri), "%s/%u/0/0/0/%u", profile, SEGMENT_FILE_SIZE, SEGMENT_RATE);
+  object.isDirectory = false;
+  object.size = SEGMENT_FILE_SIZE;
+  object.downloadIp = WiFi.localIP();
+  object.downloadPort = SEGMENT_PORT;
+  object.uri = uri;
+  uint32_t start = millis();
+  bool ok = soap.downloadSegmented(&object, checkSegment, &run, connections, segmentSize);
+  uint32_t ms = millis() - start;
+  if (!ok || run.bytes != SEGMENT_FILE_SIZE) {
+    Serial.printf("%-30s FAILED (%llu of %u bytes)\n", name, run.bytes, SEGMENT_FILE_SIZE);
+    return;
+  }
+  Serial.printf("%-30s %8u %8.1f %8u\n", name, connections, run.bytes / 1.024 / ms, ms);
+}
+
+// callback of a browse, delays each object like older versions of the library
+bool delayObject(const soapObject_t *object, void *arg)
+{
+  delay(1);
+  return countObject(object, arg);
+}
+
+// browses a directory with given yield policy, optionally delaying each object
+void benchYield(const char *name, eYieldPolicy policy, uint32_t interval, bool delayed)
+{
+  callbackRun_t run;
+  uint32_t total = 0, fastest = UINT32_MAX;
+
+  soap.setYieldPolicy(policy, interval);
+  for (int i = 0; i < BENCH_REPEATS; i++) {
+    run.objects = 0;
+    run.start = millis();
+    bool ok = soap.browseServer(0, YIELD_OBJECT_ID, delayed ? delayObject : countObject, &run);
+    uint32_t elapsed = millis() - run.start;
+    if (!ok || run.objects != 100) {
+      Serial.printf("%-30s FAILED (returned %s, objects %u)\n", name, ok ? "true" : "false", run.objects);
+      soap.setYieldPolicy(yieldWallClock);
+      return;
+    }
+    total += elapsed;
+    if (elapsed < fastest) fastest = elapsed;
+  }
+  soap.setYieldPolicy(yieldWallClock);
+  Serial.printf("%-30s %10.1f %8u %8u\n", name, 100000.0 * BENCH_REPEATS / total, total / BENCH_REPEATS, fastest);
+}
+
+// compares every field the DIDL scanner fills in with the result of the scanner before (see DidlCorpus.h)
+bool corpusMatch(const soapObject_t *o, const corpusObject_t *c, const char *parentId)
+{
+  if (o->isDirectory != c->isDirectory || o->parentId != parentId || o->id != c->id || o->name != c->name ||
+      o->size != c->size || o->sizeMissing != c->sizeMissing) {
+    return false;
+  }
+  if (c->isDirectory) return o->searchable == c->searchable;
+  return o->bitrate == c->bitrate && o->sampleFrequency == c->sampleFrequency && o->fileType == c->fileType &&
+         o->artist == c->artist && o->album == c->album && o->genre == c->genre && o->uri == c->uri &&
+#if !defined(NO_PROTOCOL_INFO)
+         o->protInfo == c->protInfo &&
+#endif
+         o->downloadIp.toString() == c->downloadIp && o->downloadPort == c->downloadPort;
+}
+
+// browses the whole corpus, checks the objects & times the scan step
+void benchCorpus(const char *name, const char *objectId)
+{
+  soapObjectVect_t result;
+  soapRequestStats_t st;
+  unsigned mismatches = 0;
+
+  uint32_t start = millis();
+  bool ok = soap.browseServer(0, objectId, &result, 0, CORPUS_OBJECTS);
+  uint32_t elapsed = millis() - start;
+  if (!ok || result.size() != CORPUS_OBJECTS) {
+    Serial.printf("%-30s FAILED (returned %s, objects %u, expected %u)\n",
+                  name, ok ? "true" : "false", (unsigned)result.size(), (unsigned)CORPUS_OBJECTS);
+    return;
+  }
+  for (int i = 0; i < CORPUS_OBJECTS; i++) {
+    if (corpusMatch(&result[i], &corpus[i], objectId)) continue;
+    if (mismatches++ == 0) Serial.printf("%-30s first mismatch: object %d, id \"%s\"\n", name, i, corpus[i].id);
+  }
+  if (soap.getLastRequestStats(&st)) {
+    Serial.printf("%-30s %8u %8u %8u %10.1f\n", name, (unsigned)result.size(), mismatches, elapsed,
+                  (float)st.scanUs / CORPUS_OBJECTS);
+  }
+  else {
+    Serial.printf("%-30s %8u %8u %8u %10s\n", name, (unsigned)result.size(), mismatches, elapsed, "-");
+  }
+}
+
+// prints timing breakdown of the last request
+void printStats(const char *name)
+{
+  soapRequestStats_t st;
+
+  if (!soap.getLastRequestStats(&st)) {
+    Serial.printf("%-30s not available, needs build option SOAP_REQUEST_STATS\n", name);
+    return;
+  }
+  Serial.printf("%-30s %7u %7u %7u %7u %7u %7u %7u %8llu %6u %7u %6d\n", name, st.connectUs, st.sentUs, 
+                st.firstByteUs, st.headerUs, st.parsedUs, st.scanUs, st.totalUs, st.bytes, st.chunks, st.objects,
+                st.heapDelta);
+}
+
+// single requests: new connection & kept-alive one, chunked reply, cache hit, download
+void benchStats()
+{
+  soapObjectVect_t result;
+  soapObject_t object;
+  size_t size;
+  uint32_t sum = 0;
+
+  soap.setKeepAlive(false);
+  soap.browseServer(0, "ums/100/0", &result);
+  printStats("browse, new connection");
+  soap.setKeepAlive(true);
+  soap.browseServer(0, "ums/100/0", &result);
+  soap.browseServer(0, "ums/100/0", &result);
+  printStats("browse, kept-alive connection");
+  soap.browseServer(0, "ums/100/128", &result);
+  printStats("browse, chunked 128");
+  soap.browseServer(0, CORPUS_OBJECT_ID, &result);
+  printStats("browse, DIDL corpus");
+  soap.setCache(SOAP_CACHE_DEFAULT_SIZE);
+  soap.browseServer(0, "ums/100/0", &result);
+  soap.browseServer(0, "ums/100/0", &result);
+  printStats("browse, cache hit");
+  soap.setCache(0);
+  object.isDirectory = false;
+  sscanf(SINK_URI, "file/%llu", &object.size);
+  object.downloadIp = WiFi.localIP();
+  object.downloadPort = STANDIN_PORT;
+  object.uri = SINK_URI;
+  if (soap.readStart(&object, &size)) {
+    soap.readTo(addBytes, &sum);
+    soap.readStop();
+  }
+  printStats("readTo() \"" SINK_URI "\"");
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  // connect to local network via WiFi
+  Serial.println();
+  Serial.print("Connecting to WiFi network ");
+  WiFi.begin(ssid, pass);
+  while ( WiFi.status() != WL_CONNECTED) {
+    Serial.print(".");
+    delay(500);
+  }
+  Serial.println();
+  Serial.print("Connected successfully. IP address: ");
+  Serial.println(WiFi.localIP());
+  Serial.println();
+
+  // start stand-in server, preferably on the other core
+  static WiFiServer server(STANDIN_PORT);
+  server.begin();
+  xTaskCreatePinnedToCore(standInTask, "standIn", 8192, &server, 1, NULL, 0);
+  soap.addServer(WiFi.localIP(), STANDIN_PORT, STANDIN_CONTROL_URL, "Stand-in Server", STANDIN_EVENT_URL);
+  for (int i = 0; i < DESC_SERVERS; i++) {
+    WiFiServer *descServer = new WiFiServer(DESC_PORT + i);
+    descServer->begin();
+    xTaskCreatePinnedToCore(standInDescTask, "standInDesc", 4096, descServer, 1, NULL, 0);
+  }
+  static WiFiServer segmentServer(SEGMENT_PORT);
+  segmentServer.begin();
+  xTaskCreatePinnedToCore(standInDescTask, "standInSeg", 4096, &segmentServer, 1, NULL, 0);
+  xTaskCreatePinnedToCore(standInAnnounceTask, "standInNotify", 4096, NULL, 1, NULL, 0);
+  xTaskCreatePinnedToCore(standInNotifyTask, "standInEvent", 4096, NULL, 1, NULL, 0);
+  Serial.printf("Stand-in server started on port %d, %d repeats per scenario\n\n", STANDIN_PORT, BENCH_REPEATS);
+
+  Serial.printf("%-30s %8s %10s %10s %8s\n", "scenario", "objects", "objects/s", "kbytes/s", "ttfo ms");
+  for (int i = 0; i < sizeof(scenarios) / sizeof(scenario_t); i++) {
+    benchBrowse(&scenarios[i]);
+  }
+  for (int i = 0; i < sizeof(downloads) / sizeof(download_t); i++) {
+    benchDownload(&downloads[i]);
+  }
+
+  Serial.printf("\nde-chunking downloads (+ ext: chunk extensions & trailer), read() in blocks of %d bytes:\n", 
+                READ_BUFFER_SIZE);
+  Serial.printf("%-30s %10s %8s\n", "download", "kbytes/s", "%");
+  benchChunked();
+
+  Serial.printf("\ndecoder reading %d kB/s in blocks of %d bytes (late: block took more than %d ms):\n", 
+                STREAM_RATE, STREAM_BLOCK, STREAM_LATE_MS);
+  Serial.printf("%-30s %8s %8s %8s %8s %8s\n", "read", "kbytes/s", "max ms", "late", "underrun", "min kB");
+  for (int i = 0; i < sizeof(streams) / sizeof(download_t); i++) {
+    Serial.printf("%s:\n", streams[i].name);
+    benchStream(&streams[i], "  directly", 0);
+    benchStream(&streams[i], "  read-ahead 32 kB", SOAP_READ_AHEAD_DEFAULT_SIZE);
+  }
+
+  Serial.printf("\nseeking to %d kB of a %d kB file, then reading %d kB (last column: status of range):\n",
+                RANGE_OFFSET / 1024, RANGE_FILE_SIZE / 1024, RANGE_LENGTH / 1024);
+  Serial.printf("%-30s %8s %8s\n", "read", "kB read", "ms");
+  benchRange();
+
+  Serial.printf("\n\"%s\" handed to a checksum:\n", SINK_URI);
+  Serial.printf("%-30s %8s %8s\n", "read", "kbytes/s", "buffer");
+  benchSink("read()", false, 0);
+  benchSink("readTo()", true, 0);
+  benchSink("read(), read-ahead 32 kB", false, SOAP_READ_AHEAD_DEFAULT_SIZE);
+  benchSink("readTo(), read-ahead 32 kB", true, SOAP_READ_AHEAD_DEFAULT_SIZE);
+
+  Serial.printf("\nsegmented download of a %d kB file, each connection limited to %d kB/s:\n",
+                SEGMENT_FILE_SIZE / 1024, SEGMENT_RATE);
+  Serial.printf("%-30s %8s %8s %8s\n", "segments", "conn.", "kbytes/s", "ms");
+  benchSegmented("single connection", "file", 1, SOAP_SEGMENT_SIZE);
+  benchSegmented("16 kB segments", "file", 2, 16384);
+  benchSegmented("16 kB segments", "file", 4, 16384);
+  benchSegmented("64 kB segments", "file", 4, 65536);
+  benchSegmented("server without ranges", "norange", 4, 16384);
+
+  Serial.printf("\ntiming breakdown of single requests (us since start of request):\n");
+  Serial.printf("%-30s %7s %7s %7s %7s %7s %7s %7s %8s %6s %7s %6s\n", "request", "connect", "sent", "first", 
+                "header", "parsed", "scan", "total", "bytes", "chunks", "objects", "heap");
+  benchStats();
+
+  Serial.printf("\nDIDL corpus of doc/Logfiles compared with the scanner before (scan us: needs SOAP_REQUEST_STATS):\n");
+  Serial.printf("%-30s %8s %8s %8s %10s\n", "reply", "objects", "mismatch", "ms", "scan us/obj");
+  benchCorpus("not chunked", CORPUS_OBJECT_ID);
+  benchCorpus("chunked 128", "corpus/0/128");
+
+  Serial.printf("\n%d sequential browses \"%s\" (last column: fastest browse ms):\n", SEQ_BROWSES, SEQ_OBJECT_ID);
+  Serial.printf("%-30s %8s %10s %10s %8s\n", "connection", "objects", "objects/s", "kbytes/s", "ms");
+  benchSequential("Connection: close", false, true);
+  benchSequential("keep-alive", true, true);
+  benchSequential("keep-alive, server closes", true, false);
+
+  Serial.printf("\n%d asynchronous browses \"%s\" (last column: longest poll() us):\n", SEQ_BROWSES, SEQ_OBJECT_ID);
+  Serial.printf("%-30s %8s %8s %8s\n", "connection", "objects", "ms", "poll us");
+  benchAsync("Connection: close", false);
+  benchAsync("keep-alive", true);
+
+  Serial.printf("\nbrowsing \"%s\" (100 objects), yield policy:\n", YIELD_OBJECT_ID);
+  Serial.printf("%-30s %10s %8s %8s\n", "policy", "objects/s", "avg ms", "min ms");
+  benchYield("delay(1) per object (before)", yieldNever, 0, true);
+  benchYield("never", yieldNever, 0, false);
+  benchYield("every 4 kB", yieldBytes, 4096, false);
+  benchYield("every 16 kB", yieldBytes, 16384, false);
+  benchYield("every 10 ms", yieldWallClock, 10, false);
+  benchYield("every 100 ms (default)", yieldWallClock, SOAP_YIELD_DEFAULT_INTERVAL, false);
+
+  Serial.printf("\n%d requests \"%s\", until received by stand-in server:\n", SEQ_BROWSES, REQ_OBJECT_ID);
+  Serial.printf("%-30s %8s %8s\n", "request", "avg us", "min us");
+  benchRequest("Browse", false);
+  benchRequest("Search, escaped criteria", true);
+
+  Serial.printf("\n%d pages \"%s\" held in:\n", MEM_PAGES, MEM_OBJECT_ID);
+  Serial.printf("%-30s %8s %10s %10s %10s\n", "result type", "blocks", "held kB", "peak kB", "largest kB");
+  benchMemory();
+
+  Serial.printf("\n%d browses \"%s\" with result cache of %d kB (first one is a miss):\n", 
+                CACHE_BROWSES, CACHE_OBJECT_ID, SOAP_CACHE_DEFAULT_SIZE / 1024);
+  Serial.printf("%-30s %8s %8s %8s %8s\n", "result type", "miss us", "hit us", "min us", "held kB");
+  soap.setCache(SOAP_CACHE_DEFAULT_SIZE);
+  benchCache("soapObjectVect_t", 0);
+  benchCache("SoapResultSet", 1);
+  benchCache("callback", 2);
+  benchCacheValidate("validateCache(), changed");
+  soap.setCache(0);
+
+  Serial.printf("\nevent subscription, \"%s\" cached:\n", CACHE_OBJECT_ID);
+  Serial.printf("%-30s %8s\n", "step", "us");
+  benchEvents();
+
+  // replaces server list
+  Serial.printf("\nseekServer(%d), %d stand-in servers, description delayed by", DESC_SCAN_DURATION, DESC_SERVERS);
+  for (int i = 0; i < DESC_SERVERS; i++) Serial.printf(" %u", (unsigned)descDelays[i]);
+  Serial.printf(" ms (last one is silent):\n");
+  Serial.printf("%-30s %8s %8s\n", "descriptions fetched", "servers", "desc ms");
+  benchSeek("one after the other", 1);
+  benchSeek("all at once", DESC_SERVERS);
+
+  Serial.printf("\nseekServerUntil(), max. %d s:\n", DESC_SCAN_DURATION);
+  Serial.printf("%-30s %8s %8s\n", "until", "servers", "total ms");
+  soapSeekUntil_t until = { .servers = 1, .friendlyName = NULL, .udn = NULL, .quietPeriod = 0 };
+  benchSeekUntil("first server", &until, 1);
+  until = { .servers = 0, .friendlyName = NULL, .udn = "uuid:stand-in-1500", .quietPeriod = 0 };
+  benchSeekUntil("UDN of 3rd server", &until, 3);
+  until = { .servers = 0, .friendlyName = NULL, .udn = NULL, .quietPeriod = 500 };
+  benchSeekUntil("quiet for 500 ms", &until, DESC_SERVERS - 1);
+  benchSeekUntil("scan duration", NULL, DESC_SERVERS - 1);
+
+  Serial.printf("\nseekServerAsync(), max. %d s (last column: longest poll() us):\n", DESC_SCAN_DURATION);
+  Serial.printf("%-30s %8s %8s %8s\n", "until", "servers", "total ms", "poll us");
+  until = { .servers = 0, .friendlyName = NULL, .udn = NULL, .quietPeriod = 500 };
+  benchSeekAsync("quiet for 500 ms", &until, DESC_SERVERS - 1);
+
+  // server list as saved to a file
+  StreamString saved;
+  soap.saveServerList(&saved);
+  String moved = saved, oldPort = String("\t") + (DESC_PORT + 1) + "\t", newPort = String("\t") + (DESC_PORT + 20) + "\t";
+  moved.replace(oldPort, newPort);
+  Serial.printf("\nrestoreServerList(), %d servers saved:\n", DESC_SERVERS - 1);
+  Serial.printf("%-30s %8s %8s\n", "saved list", "servers", "total ms");
+  benchRestore("all servers available", saved, DESC_SERVERS - 1);
+  benchRestore("one server moved", moved, DESC_SERVERS - 2);
+  benchRestore("none, full scan", "", DESC_SERVERS - 1);
+
+#ifdef SHOW_ESP32_MEMORY_STATISTICS
+  Serial.println();
+  Serial.println("Some ESP32 memory stats after running this sketch:");
+  Serial.print(" 1) minimum ever free memory of all regions [in bytes]: ");
+  Serial.println(ESP.getMinFreeHeap());
+  Serial.print(" 2) minimum ever free heap size [in bytes]:             ");
+  Serial.println(xPortGetMinimumEverFreeHeapSize());
+  Serial.print(" 3) minimum ever stack size of this task [in bytes]:    ");
+  Serial.println(uxTaskGetStackHighWaterMark(NULL));
+#endif
+
+  Serial.println();
+  Serial.println("Sketch finished.");
+}
+
+void loop() {
+  //
+}
@@ -0,0 +1,1629 @@
+/*
+  DIDL-Lite objects found in the verbose logfiles of folder doc/Logfiles, one after the other as
+  sent by the media servers (Plex, Subsonic, MS MediaPlayer & others). Each object comes with the
+  fields the DIDL scanner of the library delivered before it scanned containers & items in a single
+  pass. Objects whose log lines got mangled by the serial output are left out.
+
+  Containers: isDirectory, id, name, size, sizeMissing & searchable are set.
+  Items: all fields except searchable are set.
+  The parent id always is the object id requested.
+*/
+
+struct corpusObject_t {
+  const char *didl;               // object as sent by the server (DIDL-Lite, not yet escaped for SOAP)
+  bool        isDirectory;
+  const char *id;
+  const char *name;
+  uint64_t    size;
+  bool        sizeMissing;
+  bool        searchable;         // containers only
+  int         bitrate;            // items only from here on
+  int         sampleFrequency;
+  eFileType   fileType;
+  const char *artist;
+  const char *album;
+  const char *genre;
+  const char *protInfo;
+  const char *uri;
+  const char *downloadIp;
+  uint16_t    downloadPort;
+};
+
+const corpusObject_t corpus[] = {
+  // BrowseRecursively_Ethernet_5-Verbose_Plex.log
+  { "<container id=\"94467912-bd40-4d2f-ad25-7b8423f7b05a\" parentID=\"0\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Video</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>Video</dc:description><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "94467912-bd40-4d2f-ad25-7b8423f7b05a", "Video", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"abe6121c-1731-4683-815c-89e1dcd2bf11\" parentID=\"0\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Music</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>Music</dc:description><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "abe6121c-1731-4683-815c-89e1dcd2bf11", "Music", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"b0184133-f840-4a4f-a583-45f99645edcd\" parentID=\"0\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Photos</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>Photos</dc:description><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "b0184133-f840-4a4f-a583-45f99645edcd", "Photos", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"02a3bbaeaac8b33cd5f8\" parentID=\"94467912-bd40-4d2f-ad25-7b8423f7b05a\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Movies</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<upnp:albumArtURI dlna:profileID=\"JPEG_MED\">http://192.168.1.42:32469/proxy/f3c6894c80e0db824e66/albumart.jpg</upnp:albumArtURI>"
+    "<dc:description>Movies</dc:description>"
+    "<upnp:icon>http://192.168.1.42:32469/proxy/62a8c2db4739d51b4c91/icon.jpg</upnp:icon>"
+    "<upnp:class>object.container.playlistContainer</upnp:class></container>",
+    true, "02a3bbaeaac8b33cd5f8", "Movies", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"91394f20-aec1-4cf8-80f2-803b5119f3df\" parentID=\"94467912-bd40-4d2f-ad25-7b8423f7b05a\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Video Channels</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>Video Channels</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "91394f20-aec1-4cf8-80f2-803b5119f3df", "Video Channels", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"f0ab4250-3f5c-49a6-a9eb-c4ca01b9faec\" parentID=\"94467912-bd40-4d2f-ad25-7b8423f7b05a\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Preferences</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>Preferences</dc:description><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "f0ab4250-3f5c-49a6-a9eb-c4ca01b9faec", "Preferences", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"2f3f46568331e28dfe60\" parentID=\"02a3bbaeaac8b33cd5f8\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>All Movies</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>All Movies</dc:description><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "2f3f46568331e28dfe60", "All Movies", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"8a7293dd5ac20b348a69\" parentID=\"02a3bbaeaac8b33cd5f8\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Unplayed</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>Unplayed</dc:description><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "8a7293dd5ac20b348a69", "Unplayed", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"aa05c6e8dca21573826b\" parentID=\"02a3bbaeaac8b33cd5f8\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Recently Released</dc:title><dc:creator>Unknown</dc:creator>"
+    "<upnp:genre>Unknown</upnp:genre><dc:description>Recently Released</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "aa05c6e8dca21573826b", "Recently Released", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"48936c2c884d6b33e6d7\" parentID=\"02a3bbaeaac8b33cd5f8\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Recently Added</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>Recently Added</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "48936c2c884d6b33e6d7", "Recently Added", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"9ddec56ec72ba55c7644\" parentID=\"02a3bbaeaac8b33cd5f8\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Recently Viewed</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>Recently Viewed</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "9ddec56ec72ba55c7644", "Recently Viewed", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"28026a4391190c3d3fd3\" parentID=\"02a3bbaeaac8b33cd5f8\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Continue Watching</dc:title><dc:creator>Unknown</dc:creator>"
+    "<upnp:genre>Unknown</upnp:genre><dc:description>Continue Watching</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "28026a4391190c3d3fd3", "Continue Watching", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"004a2dfc29fcffb731eb\" parentID=\"02a3bbaeaac8b33cd5f8\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>By Collection</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>By Collection</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "004a2dfc29fcffb731eb", "By Collection", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"8d73e2ff1138d7a84c97\" parentID=\"02a3bbaeaac8b33cd5f8\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>By Genre</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>By Genre</dc:description><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "8d73e2ff1138d7a84c97", "By Genre", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"822d3b787795413d1b54\" parentID=\"02a3bbaeaac8b33cd5f8\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>By Year</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>By Year</dc:description><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "822d3b787795413d1b54", "By Year", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"d9cd4330bf4aba3eaf20\" parentID=\"02a3bbaeaac8b33cd5f8\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>By Decade</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>By Decade</dc:description><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "d9cd4330bf4aba3eaf20", "By Decade", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"861614ebd5186ec2e76e\" parentID=\"02a3bbaeaac8b33cd5f8\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>By Director</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>By Director</dc:description><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "861614ebd5186ec2e76e", "By Director", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"dae8abd12c0ae963f254\" parentID=\"02a3bbaeaac8b33cd5f8\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>By Starring Actor</dc:title><dc:creator>Unknown</dc:creator>"
+    "<upnp:genre>Unknown</upnp:genre><dc:description>By Starring Actor</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "dae8abd12c0ae963f254", "By Starring Actor", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"78eac2090e5460fd1c0e\" parentID=\"02a3bbaeaac8b33cd5f8\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>By Country</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>By Country</dc:description><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "78eac2090e5460fd1c0e", "By Country", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"e997f329e66f4e403764\" parentID=\"02a3bbaeaac8b33cd5f8\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>By Content Rating</dc:title><dc:creator>Unknown</dc:creator>"
+    "<upnp:genre>Unknown</upnp:genre><dc:description>By Content Rating</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "e997f329e66f4e403764", "By Content Rating", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"45be02f7128d082a6b57\" parentID=\"02a3bbaeaac8b33cd5f8\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>By Rating</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>By Rating</dc:description><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "45be02f7128d082a6b57", "By Rating", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"33b5eb203d4b49b02d65\" parentID=\"02a3bbaeaac8b33cd5f8\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>By Resolution</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>By Resolution</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "33b5eb203d4b49b02d65", "By Resolution", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"3502f58b1872af67557a\" parentID=\"02a3bbaeaac8b33cd5f8\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>By First Letter</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>By First Letter</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "3502f58b1872af67557a", "By First Letter", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"945377f19f0c486135f7\" parentID=\"02a3bbaeaac8b33cd5f8\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>By Folder</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>By Folder</dc:description><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "945377f19f0c486135f7", "By Folder", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"2b34ec14-d674-4421-a8e6-f393af4e54ce\" parentID=\"f0ab4250-3f5c-49a6-a9eb-c4ca01b9faec\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Direct Play [Enabled]</dc:title><dc:creator>Unknown</dc:creator>"
+    "<upnp:genre>Unknown</upnp:genre><dc:description>Direct Play</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "2b34ec14-d674-4421-a8e6-f393af4e54ce", "Direct Play [Enabled]", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"20511860-52b5-42d2-87b8-f3fbf327bf73\" parentID=\"f0ab4250-3f5c-49a6-a9eb-c4ca01b9faec\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Direct Stream [Enabled]</dc:title><dc:creator>Unknown</dc:creator>"
+    "<upnp:genre>Unknown</upnp:genre><dc:description>Direct Stream</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "20511860-52b5-42d2-87b8-f3fbf327bf73", "Direct Stream [Enabled]", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"1bcb51e3-0846-4d88-9960-9b78e2a53f7c\" parentID=\"f0ab4250-3f5c-49a6-a9eb-c4ca01b9faec\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Local Resolution [1080p]</dc:title><dc:creator>Unknown</dc:creator>"
+    "<upnp:genre>Unknown</upnp:genre><dc:description>Local Resolution</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "1bcb51e3-0846-4d88-9960-9b78e2a53f7c", "Local Resolution [1080p]", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"52557847-e9d7-49f6-b9fa-e6b54923190d\" parentID=\"f0ab4250-3f5c-49a6-a9eb-c4ca01b9faec\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Local Video Quality [High]</dc:title><dc:creator>Unknown</dc:creator>"
+    "<upnp:genre>Unknown</upnp:genre><dc:description>Local Video Quality</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "52557847-e9d7-49f6-b9fa-e6b54923190d", "Local Video Quality [High]", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"20601bf7-4e3e-4ce1-b23a-bf2a6e733604\" parentID=\"f0ab4250-3f5c-49a6-a9eb-c4ca01b9faec\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Remote Resolution [720p]</dc:title><dc:creator>Unknown</dc:creator>"
+    "<upnp:genre>Unknown</upnp:genre><dc:description>Remote Resolution</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "20601bf7-4e3e-4ce1-b23a-bf2a6e733604", "Remote Resolution [720p]", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"68d268a3-4f11-4d40-a738-b456c69e7737\" parentID=\"f0ab4250-3f5c-49a6-a9eb-c4ca01b9faec\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Remote Video Quality [Medium]</dc:title><dc:creator>Unknown</dc:creator>"
+    "<upnp:genre>Unknown</upnp:genre><dc:description>Remote Video Quality</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "68d268a3-4f11-4d40-a738-b456c69e7737", "Remote Video Quality [Medium]", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"ae5f8ee8-bb0c-4b77-899f-728fa3929640\" parentID=\"f0ab4250-3f5c-49a6-a9eb-c4ca01b9faec\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Online Resolution [720p]</dc:title><dc:creator>Unknown</dc:creator>"
+    "<upnp:genre>Unknown</upnp:genre><dc:description>Online Resolution</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "ae5f8ee8-bb0c-4b77-899f-728fa3929640", "Online Resolution [720p]", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"e662010b-3afe-4695-a60d-0a5a7ed35892\" parentID=\"f0ab4250-3f5c-49a6-a9eb-c4ca01b9faec\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Online Video Quality [Medium]</dc:title><dc:creator>Unknown</dc:creator>"
+    "<upnp:genre>Unknown</upnp:genre><dc:description>Online Video Quality</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "e662010b-3afe-4695-a60d-0a5a7ed35892", "Online Video Quality [Medium]", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"c3588f27-26cb-4b2d-8cd9-453fd3fa12ce\" parentID=\"f0ab4250-3f5c-49a6-a9eb-c4ca01b9faec\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Subtitle Size [Normal]</dc:title><dc:creator>Unknown</dc:creator>"
+    "<upnp:genre>Unknown</upnp:genre><dc:description>Subtitle Size</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "c3588f27-26cb-4b2d-8cd9-453fd3fa12ce", "Subtitle Size [Normal]", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"8fc57947-ba5c-4efe-b550-e88b0ac9a17e\" parentID=\"f0ab4250-3f5c-49a6-a9eb-c4ca01b9faec\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Audio Boost [None]</dc:title><dc:creator>Unknown</dc:creator>"
+    "<upnp:genre>Unknown</upnp:genre><dc:description>Audio Boost</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "8fc57947-ba5c-4efe-b550-e88b0ac9a17e", "Audio Boost [None]", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"3fb0bde8e29024533e6e\" parentID=\"abe6121c-1731-4683-815c-89e1dcd2bf11\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Music</dc:title><dc:creator>Music</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<upnp:albumArtURI dlna:profileID=\"JPEG_MED\">http://192.168.1.42:32469/proxy/f374280c1a2c0b6e64a7/albumart.jpg</upnp:albumArtURI>"
+    "<dc:description>Music</dc:description>"
+    "<upnp:icon>http://192.168.1.42:32469/proxy/6a1593ec15d46a228bf4/icon.jpg</upnp:icon>"
+    "<upnp:class>object.container.person.musicArtist</upnp:class></container>",
+    true, "3fb0bde8e29024533e6e", "Music", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"aca21a34-d277-4d9d-9602-687d89765172\" parentID=\"abe6121c-1731-4683-815c-89e1dcd2bf11\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Music Channels</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>Music Channels</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "aca21a34-d277-4d9d-9602-687d89765172", "Music Channels", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"d3611e72-8a03-424c-90fd-7dea335ecf7d\" parentID=\"abe6121c-1731-4683-815c-89e1dcd2bf11\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Preferences</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>Preferences</dc:description><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "d3611e72-8a03-424c-90fd-7dea335ecf7d", "Preferences", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"7f48e7286759eef09ffd\" parentID=\"3fb0bde8e29024533e6e\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>All Artists</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>All Artists</dc:description><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "7f48e7286759eef09ffd", "All Artists", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"4c444df9d766e6c55fa0\" parentID=\"3fb0bde8e29024533e6e\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>By Album</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>By Album</dc:description><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "4c444df9d766e6c55fa0", "By Album", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"0b09c9afcba2f45f33c2\" parentID=\"3fb0bde8e29024533e6e\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>By Genre</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>By Genre</dc:description><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "0b09c9afcba2f45f33c2", "By Genre", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"91fd8a6c02ef64478e2c\" parentID=\"3fb0bde8e29024533e6e\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>By Decade</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>By Decade</dc:description><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "91fd8a6c02ef64478e2c", "By Decade", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"59b63e37423b6662b034\" parentID=\"3fb0bde8e29024533e6e\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>By Year</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>By Year</dc:description><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "59b63e37423b6662b034", "By Year", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"79bcfd9132cbdb2cc2e2\" parentID=\"3fb0bde8e29024533e6e\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>By Collection</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>By Collection</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "79bcfd9132cbdb2cc2e2", "By Collection", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"5557a31a4a43b53e38f1\" parentID=\"3fb0bde8e29024533e6e\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Recently Added</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>Recently Added</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "5557a31a4a43b53e38f1", "Recently Added", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"25eed1fc1600ccfaedd4\" parentID=\"3fb0bde8e29024533e6e\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>By Folder</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>By Folder</dc:description><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "25eed1fc1600ccfaedd4", "By Folder", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"88d79be9-9512-4109-9619-b75b0352def8\" parentID=\"d3611e72-8a03-424c-90fd-7dea335ecf7d\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Music Transcode Bitrate [192kbps]</dc:title><dc:creator>Unknown</dc:creator>"
+    "<upnp:genre>Unknown</upnp:genre><dc:description>Music Transcode Bitrate</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "88d79be9-9512-4109-9619-b75b0352def8", "Music Transcode Bitrate [192kbps]", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"b1701ca5-0ae1-4211-87fe-2641c05e22e5\" parentID=\"b0184133-f840-4a4f-a583-45f99645edcd\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Photo Channels</dc:title><dc:creator>Unknown</dc:creator><upnp:genre>Unknown</upnp:genre>"
+    "<dc:description>Photo Channels</dc:description>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "b1701ca5-0ae1-4211-87fe-2641c05e22e5", "Photo Channels", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  // BrowseRecursively_Ethernet_5-Verbose_Subsonic.log
+  { "<container childCount=\"104\" id=\"folder-1\" parentID=\"0\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Music</dc:title><upnp:class>object.container.album.musicAlbum</upnp:class></container>",
+    true, "folder-1", "Music", 104, false, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container childCount=\"3\" id=\"folder-2\" parentID=\"0\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Videos</dc:title><upnp:class>object.container.album.musicAlbum</upnp:class></container>",
+    true, "folder-2", "Videos", 3, false, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container childCount=\"0\" id=\"playlists\" parentID=\"0\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Playlists</dc:title><upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "playlists", "Playlists", 0, false, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container childCount=\"8\" id=\"folder-72\" parentID=\"1\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Deutsch Pop</dc:title><upnp:class>object.container.album.musicAlbum</upnp:class>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=72&amp;auth=1979787348&amp;size=300</upnp:albumArtURI>"
+    "<upnp:artist>Adel Tawil</upnp:artist><dc:description/></container>",
+    true, "folder-72", "Deutsch Pop", 8, false, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container childCount=\"4\" id=\"folder-68\" parentID=\"1\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Car-CD1</dc:title><upnp:class>object.container.album.musicAlbum</upnp:class>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=68&amp;auth=52828418&amp;size=300</upnp:albumArtURI>"
+    "<upnp:artist>Ben Harper</upnp:artist><dc:description/></container>",
+    true, "folder-68", "Car-CD1", 4, false, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<item id=\"3\" parentID=\"1\" restricted=\"1\"><dc:title>Forever Young</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 3</upnp:album>"
+    "<upnp:artist>Alphaville</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:03:46.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=3&amp;auth=305343284&amp;player=6</res>"
+    "</item>",
+    false, "3", "Forever Young", 0, true, false, 0, 0, fileTypeAudio,
+    "Alphaville", "Car-CD 3", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=3&auth=305343284&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"4\" parentID=\"1\" restricted=\"1\"><dc:title>This Is The Life</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 2</upnp:album>"
+    "<upnp:artist>Amy Macdonald</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Pop</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2007-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:03:06.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=4&amp;auth=1914176139&amp;player=6</res>"
+    "</item>",
+    false, "4", "This Is The Life", 0, true, false, 0, 0, fileTypeAudio,
+    "Amy Macdonald", "Car-CD 2", "Pop",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=4&auth=1914176139&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"5\" parentID=\"1\" restricted=\"1\"><dc:title>Excuse me Mr.</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 1</upnp:album>"
+    "<upnp:artist>Ben Harper</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:04:54.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=5&amp;auth=1963081628&amp;player=6</res>"
+    "</item>",
+    false, "5", "Excuse me Mr.", 0, true, false, 0, 0, fileTypeAudio,
+    "Ben Harper", "Car-CD 1", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=5&auth=1963081628&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"6\" parentID=\"1\" restricted=\"1\"><dc:title>Sick And Tired</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 1</upnp:album>"
+    "<upnp:artist>Anastacia</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:03:28.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=6&amp;auth=797951168&amp;player=6</res>"
+    "</item>",
+    false, "6", "Sick And Tired", 0, true, false, 0, 0, fileTypeAudio,
+    "Anastacia", "Car-CD 1", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=6&auth=797951168&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"7\" parentID=\"1\" restricted=\"1\"><dc:title>A New Day Has Come</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 3</upnp:album>"
+    "<upnp:artist>Celine Dion</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Pop</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2002-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:04:19.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=7&amp;auth=937142877&amp;player=6</res>"
+    "</item>",
+    false, "7", "A New Day Has Come", 0, true, false, 0, 0, fileTypeAudio,
+    "Celine Dion", "Car-CD 3", "Pop",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=7&auth=937142877&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"10\" parentID=\"1\" restricted=\"1\"><dc:title>China Girl</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 3</upnp:album>"
+    "<upnp:artist>David Bowie</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:05:34.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=10&amp;auth=650018712&amp;player=6</res>"
+    "</item>",
+    false, "10", "China Girl", 0, true, false, 0, 0, fileTypeAudio,
+    "David Bowie", "Car-CD 3", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=10&auth=650018712&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"11\" parentID=\"1\" restricted=\"1\"><dc:title>Major Tom (German Version)</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 1</upnp:album>"
+    "<upnp:artist>Peter Schilling</upnp:artist><upnp:originalTrackNumber/><upnp:genre>NDW</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:04:00.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=11&amp;auth=141206504&amp;player=6</res>"
+    "</item>",
+    false, "11", "Major Tom (German Version)", 0, true, false, 0, 0, fileTypeAudio,
+    "Peter Schilling", "Car-CD 1", "NDW",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=11&auth=141206504&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"12\" parentID=\"1\" restricted=\"1\"><dc:title>Der Kommissar</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 3</upnp:album>"
+    "<upnp:artist>Falco</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Pop</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2001-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:03:54.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=12&amp;auth=927888820&amp;player=6</res>"
+    "</item>",
+    false, "12", "Der Kommissar", 0, true, false, 0, 0, fileTypeAudio,
+    "Falco", "Car-CD 3", "Pop",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=12&auth=927888820&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"14\" parentID=\"1\" restricted=\"1\"><dc:title>Sweet About Me</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 3</upnp:album>"
+    "<upnp:artist>Gabriella Cilmi</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2007-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:03:27.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=14&amp;auth=1274057735&amp;player=6</res>"
+    "</item>",
+    false, "14", "Sweet About Me", 0, true, false, 0, 0, fileTypeAudio,
+    "Gabriella Cilmi", "Car-CD 3", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=14&auth=1274057735&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"15\" parentID=\"1\" restricted=\"1\"><dc:title>Summer In The City</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 2</upnp:album>"
+    "<upnp:artist>Lovin' Spoonful</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:genre>Classic Rock</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2000-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:02:41.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=15&amp;auth=1589647806&amp;player=6</res>"
+    "</item>",
+    false, "15", "Summer In The City", 0, true, false, 0, 0, fileTypeAudio,
+    "Lovin' Spoonful", "Car-CD 2", "Classic Rock",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=15&auth=1589647806&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"16\" parentID=\"1\" restricted=\"1\"><dc:title>A million miles away</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 1</upnp:album>"
+    "<upnp:artist>Rory Gallagher</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Blues</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:09:29.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=16&amp;auth=1297239815&amp;player=6</res>"
+    "</item>",
+    false, "16", "A million miles away", 0, true, false, 0, 0, fileTypeAudio,
+    "Rory Gallagher", "Car-CD 1", "Blues",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=16&auth=1297239815&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"17\" parentID=\"1\" restricted=\"1\"><dc:title>Sounds Like A Melody</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 3</upnp:album>"
+    "<upnp:artist>Alphaville</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Pop</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>1984-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:04:46.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=17&amp;auth=497107384&amp;player=6</res>"
+    "</item>",
+    false, "17", "Sounds Like A Melody", 0, true, false, 0, 0, fileTypeAudio,
+    "Alphaville", "Car-CD 3", "Pop",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=17&auth=497107384&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"18\" parentID=\"1\" restricted=\"1\"><dc:title>Dutch Mountains</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 1</upnp:album>"
+    "<upnp:artist>Nits</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Pop</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:03:35.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=18&amp;auth=1554680860&amp;player=6</res>"
+    "</item>",
+    false, "18", "Dutch Mountains", 0, true, false, 0, 0, fileTypeAudio,
+    "Nits", "Car-CD 1", "Pop",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=18&auth=1554680860&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"19\" parentID=\"1\" restricted=\"1\"><dc:title>On my way to LA (long)</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 2</upnp:album>"
+    "<upnp:artist>Phil Carmen</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:06:57.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=19&amp;auth=1208314558&amp;player=6</res>"
+    "</item>",
+    false, "19", "On my way to LA (long)", 0, true, false, 0, 0, fileTypeAudio,
+    "Phil Carmen", "Car-CD 2", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=19&auth=1208314558&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"20\" parentID=\"1\" restricted=\"1\"><dc:title>500 Miles</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 1</upnp:album>"
+    "<upnp:artist>Hooters</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Folk</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:04:24.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=20&amp;auth=1365046424&amp;player=6</res>"
+    "</item>",
+    false, "20", "500 Miles", 0, true, false, 0, 0, fileTypeAudio,
+    "Hooters", "Car-CD 1", "Folk",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=20&auth=1365046424&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"21\" parentID=\"1\" restricted=\"1\"><dc:title>Always The Sun</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 2</upnp:album>"
+    "<upnp:artist>Stranglers</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2010-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:04:05.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=21&amp;auth=245958698&amp;player=6</res>"
+    "</item>",
+    false, "21", "Always The Sun", 0, true, false, 0, 0, fileTypeAudio,
+    "Stranglers", "Car-CD 2", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=21&auth=245958698&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"22\" parentID=\"1\" restricted=\"1\"><dc:title>From the land down under</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 1</upnp:album>"
+    "<upnp:artist>Men at Work</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Rock</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:03:40.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=22&amp;auth=556774481&amp;player=6</res>"
+    "</item>",
+    false, "22", "From the land down under", 0, true, false, 0, 0, fileTypeAudio,
+    "Men at Work", "Car-CD 1", "Rock",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=22&auth=556774481&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"23\" parentID=\"1\" restricted=\"1\"><dc:title>One Night in Bangkok</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 3</upnp:album>"
+    "<upnp:artist>Murray Head</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Rock</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2001-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:04:08.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=23&amp;auth=784429806&amp;player=6</res>"
+    "</item>",
+    false, "23", "One Night in Bangkok", 0, true, false, 0, 0, fileTypeAudio,
+    "Murray Head", "Car-CD 3", "Rock",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=23&auth=784429806&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"24\" parentID=\"1\" restricted=\"1\"><dc:title>Sing</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 2</upnp:album>"
+    "<upnp:artist>Travis</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:03:45.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=24&amp;auth=1640566052&amp;player=6</res>"
+    "</item>",
+    false, "24", "Sing", 0, true, false, 0, 0, fileTypeAudio,
+    "Travis", "Car-CD 2", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=24&auth=1640566052&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"25\" parentID=\"1\" restricted=\"1\"><dc:title>Material World</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 1</upnp:album>"
+    "<upnp:artist>Police</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Pop</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:02:58.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=25&amp;auth=1063165266&amp;player=6</res>"
+    "</item>",
+    false, "25", "Material World", 0, true, false, 0, 0, fileTypeAudio,
+    "Police", "Car-CD 1", "Pop",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=25&auth=1063165266&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"26\" parentID=\"1\" restricted=\"1\"><dc:title>Stars</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 2</upnp:album>"
+    "<upnp:artist>Roxette</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Pop</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>1999-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:03:56.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=26&amp;auth=324045847&amp;player=6</res>"
+    "</item>",
+    false, "26", "Stars", 0, true, false, 0, 0, fileTypeAudio,
+    "Roxette", "Car-CD 2", "Pop",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=26&auth=324045847&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"28\" parentID=\"1\" restricted=\"1\"><dc:title>I Feel Good</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 2</upnp:album>"
+    "<upnp:artist>James Brown</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:02:47.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=28&amp;auth=1192279075&amp;player=6</res>"
+    "</item>",
+    false, "28", "I Feel Good", 0, true, false, 0, 0, fileTypeAudio,
+    "James Brown", "Car-CD 2", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=28&auth=1192279075&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"30\" parentID=\"1\" restricted=\"1\"><dc:title>Blueprint</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 1</upnp:album>"
+    "<upnp:artist>Rainbirds</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Industrial</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>1999-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:05:31.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=30&amp;auth=1432260&amp;player=6</res>"
+    "</item>",
+    false, "30", "Blueprint", 0, true, false, 0, 0, fileTypeAudio,
+    "Rainbirds", "Car-CD 1", "Industrial",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=30&auth=1432260&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"31\" parentID=\"1\" restricted=\"1\"><dc:title>74-75</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 1</upnp:album>"
+    "<upnp:artist>Connells</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:04:41.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=31&amp;auth=303665634&amp;player=6</res>"
+    "</item>",
+    false, "31", "74-75", 0, true, false, 0, 0, fileTypeAudio,
+    "Connells", "Car-CD 1", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=31&auth=303665634&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"32\" parentID=\"1\" restricted=\"1\"><dc:title>Someone new</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 2</upnp:album>"
+    "<upnp:artist>Escobar &amp; Heather Nova</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2001-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:03:31.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=32&amp;auth=682152812&amp;player=6</res>"
+    "</item>",
+    false, "32", "Someone new", 0, true, false, 0, 0, fileTypeAudio,
+    "Escobar & Heather Nova", "Car-CD 2", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=32&auth=682152812&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"33\" parentID=\"1\" restricted=\"1\"><dc:title>Go West</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 3</upnp:album>"
+    "<upnp:artist>Pet Shop Boys</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:05:00.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=33&amp;auth=732254469&amp;player=6</res>"
+    "</item>",
+    false, "33", "Go West", 0, true, false, 0, 0, fileTypeAudio,
+    "Pet Shop Boys", "Car-CD 3", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=33&auth=732254469&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"34\" parentID=\"1\" restricted=\"1\"><dc:title>Nothing Compares 2 U</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 3</upnp:album>"
+    "<upnp:artist>Sinéad O'Connor</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:genre>Pop/Rock</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:05:10.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=34&amp;auth=744677332&amp;player=6</res>"
+    "</item>",
+    false, "34", "Nothing Compares 2 U", 0, true, false, 0, 0, fileTypeAudio,
+    "Sinéad O'Connor", "Car-CD 3", "Pop/Rock",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=34&auth=744677332&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"35\" parentID=\"1\" restricted=\"1\"><dc:title>My Name Is Luka</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 2</upnp:album>"
+    "<upnp:artist>Suzanne Vega</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:03:49.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=35&amp;auth=713015974&amp;player=6</res>"
+    "</item>",
+    false, "35", "My Name Is Luka", 0, true, false, 0, 0, fileTypeAudio,
+    "Suzanne Vega", "Car-CD 2", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=35&auth=713015974&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"36\" parentID=\"1\" restricted=\"1\"><dc:title>Because The Night</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 1</upnp:album>"
+    "<upnp:artist>Ten Thousand Maniacs</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:genre>Folk Rock</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:03:43.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=36&amp;auth=87219051&amp;player=6</res>"
+    "</item>",
+    false, "36", "Because The Night", 0, true, false, 0, 0, fileTypeAudio,
+    "Ten Thousand Maniacs", "Car-CD 1", "Folk Rock",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=36&auth=87219051&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"37\" parentID=\"1\" restricted=\"1\"><dc:title>Set Fire to the Rain</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 2</upnp:album>"
+    "<upnp:artist>Adele</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Pop</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2011-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:04:01.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=37&amp;auth=621530655&amp;player=6</res>"
+    "</item>",
+    false, "37", "Set Fire to the Rain", 0, true, false, 0, 0, fileTypeAudio,
+    "Adele", "Car-CD 2", "Pop",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=37&auth=621530655&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"38\" parentID=\"1\" restricted=\"1\"><dc:title>Our house</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 1</upnp:album>"
+    "<upnp:artist>Madness</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Disco + 80</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2002-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:03:21.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=38&amp;auth=617814695&amp;player=6</res>"
+    "</item>",
+    false, "38", "Our house", 0, true, false, 0, 0, fileTypeAudio,
+    "Madness", "Car-CD 1", "Disco + 80",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=38&auth=617814695&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"39\" parentID=\"1\" restricted=\"1\"><dc:title>Super Girl</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 3</upnp:album>"
+    "<upnp:artist>Reamonn</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:03:51.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=39&amp;auth=239552145&amp;player=6</res>"
+    "</item>",
+    false, "39", "Super Girl", 0, true, false, 0, 0, fileTypeAudio,
+    "Reamonn", "Car-CD 3", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=39&auth=239552145&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"40\" parentID=\"1\" restricted=\"1\"><dc:title>Hands Clean</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 1</upnp:album>"
+    "<upnp:artist>Alanis Morissette</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2002-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:04:31.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=40&amp;auth=1988975253&amp;player=6</res>"
+    "</item>",
+    false, "40", "Hands Clean", 0, true, false, 0, 0, fileTypeAudio,
+    "Alanis Morissette", "Car-CD 1", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=40&auth=1988975253&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"41\" parentID=\"1\" restricted=\"1\"><dc:title>Hotel California</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>The Eagles Best Of</upnp:album>"
+    "<upnp:artist>The Eagles</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Rock</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:07:12.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=41&amp;auth=752183374&amp;player=6</res>"
+    "</item>",
+    false, "41", "Hotel California", 0, true, false, 0, 0, fileTypeAudio,
+    "The Eagles", "The Eagles Best Of", "Rock",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=41&auth=752183374&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"42\" parentID=\"1\" restricted=\"1\"><dc:title>Abracadabra</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 2</upnp:album>"
+    "<upnp:artist>Steve Miller Band</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:05:08.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=42&amp;auth=2144018828&amp;player=6</res>"
+    "</item>",
+    false, "42", "Abracadabra", 0, true, false, 0, 0, fileTypeAudio,
+    "Steve Miller Band", "Car-CD 2", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=42&auth=2144018828&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"43\" parentID=\"1\" restricted=\"1\"><dc:title>No Milk Today</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 3</upnp:album>"
+    "<upnp:artist>Herman's Hermits</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:02:50.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=43&amp;auth=250840319&amp;player=6</res>"
+    "</item>",
+    false, "43", "No Milk Today", 0, true, false, 0, 0, fileTypeAudio,
+    "Herman's Hermits", "Car-CD 3", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=43&auth=250840319&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"44\" parentID=\"1\" restricted=\"1\"><dc:title>Stay</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 1</upnp:album>"
+    "<upnp:artist>Rihanna Feat Mikky Ekko</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:genre>Pop</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2012-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:04:00.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=44&amp;auth=417604636&amp;player=6</res>"
+    "</item>",
+    false, "44", "Stay", 0, true, false, 0, 0, fileTypeAudio,
+    "Rihanna Feat Mikky Ekko", "Car-CD 1", "Pop",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=44&auth=417604636&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"45\" parentID=\"1\" restricted=\"1\"><dc:title>You Got it</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 2</upnp:album>"
+    "<upnp:artist>Roy Orbison</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2004-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:03:33.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=45&amp;auth=285041272&amp;player=6</res>"
+    "</item>",
+    false, "45", "You Got it", 0, true, false, 0, 0, fileTypeAudio,
+    "Roy Orbison", "Car-CD 2", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=45&auth=285041272&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"47\" parentID=\"1\" restricted=\"1\"><dc:title>Talk To Me</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 2</upnp:album>"
+    "<upnp:artist>Heather Nova</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:04:05.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=47&amp;auth=891907503&amp;player=6</res>"
+    "</item>",
+    false, "47", "Talk To Me", 0, true, false, 0, 0, fileTypeAudio,
+    "Heather Nova", "Car-CD 2", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=47&auth=891907503&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"48\" parentID=\"1\" restricted=\"1\"><dc:title>Lady In Black</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 3</upnp:album>"
+    "<upnp:artist>Uriah Heep</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:04:40.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=48&amp;auth=823396676&amp;player=6</res>"
+    "</item>",
+    false, "48", "Lady In Black", 0, true, false, 0, 0, fileTypeAudio,
+    "Uriah Heep", "Car-CD 3", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=48&auth=823396676&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"49\" parentID=\"1\" restricted=\"1\"><dc:title>Down To The River</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 2</upnp:album>"
+    "<upnp:artist>Bruce Springsteen</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Pop</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:06:01.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=49&amp;auth=194560537&amp;player=6</res>"
+    "</item>",
+    false, "49", "Down To The River", 0, true, false, 0, 0, fileTypeAudio,
+    "Bruce Springsteen", "Car-CD 2", "Pop",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=49&auth=194560537&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"50\" parentID=\"1\" restricted=\"1\">"
+    "<dc:title>San Francisco (Be Sure To Wear Flowers In You Hair)</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 3</upnp:album>"
+    "<upnp:artist>Scott Mc Kenzie</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:genre>Folk Rock</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:02:59.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=50&amp;auth=1816750283&amp;player=6</res>"
+    "</item>",
+    false, "50", "San Francisco (Be Sure To Wear Flowers In You Hair)", 0, true, false, 0, 0, fileTypeAudio,
+    "Scott Mc Kenzie", "Car-CD 3", "Folk Rock",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=50&auth=1816750283&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"51\" parentID=\"1\" restricted=\"1\"><dc:title>Love Hurts</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 1</upnp:album>"
+    "<upnp:artist>Nazareth</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Rock</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2013-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:03:51.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=51&amp;auth=1094791686&amp;player=6</res>"
+    "</item>",
+    false, "51", "Love Hurts", 0, true, false, 0, 0, fileTypeAudio,
+    "Nazareth", "Car-CD 1", "Rock",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=51&auth=1094791686&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"52\" parentID=\"1\" restricted=\"1\"><dc:title>Let Her Go</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 3</upnp:album>"
+    "<upnp:artist>Passenger</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Rock</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2012-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:04:12.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=52&amp;auth=1663516951&amp;player=6</res>"
+    "</item>",
+    false, "52", "Let Her Go", 0, true, false, 0, 0, fileTypeAudio,
+    "Passenger", "Car-CD 3", "Rock",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=52&auth=1663516951&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"53\" parentID=\"1\" restricted=\"1\"><dc:title>One</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 2</upnp:album>"
+    "<upnp:artist>U2</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Rock</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2006-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:04:36.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=53&amp;auth=634890688&amp;player=6</res>"
+    "</item>",
+    false, "53", "One", 0, true, false, 0, 0, fileTypeAudio,
+    "U2", "Car-CD 2", "Rock",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=53&auth=634890688&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"57\" parentID=\"1\" restricted=\"1\"><dc:title>Don't Forget About Me</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 6</upnp:album>"
+    "<upnp:artist>Alice Boman</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:03:04.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=57&amp;auth=473709877&amp;player=6</res>"
+    "</item>",
+    false, "57", "Don't Forget About Me", 0, true, false, 0, 0, fileTypeAudio,
+    "Alice Boman", "Car-CD 6", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=57&auth=473709877&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"58\" parentID=\"1\" restricted=\"1\"><dc:title>Bad Ideas</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 4</upnp:album>"
+    "<upnp:artist>Alle Farben</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Pop</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2017-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:02:46.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=58&amp;auth=1117447445&amp;player=6</res>"
+    "</item>",
+    false, "58", "Bad Ideas", 0, true, false, 0, 0, fileTypeAudio,
+    "Alle Farben", "Car-CD 4", "Pop",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=58&auth=1117447445&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"59\" parentID=\"1\" restricted=\"1\"><dc:title>She Moves</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 4</upnp:album>"
+    "<upnp:artist>Alle Farben</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Pop</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2014-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:03:13.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=59&amp;auth=1555278094&amp;player=6</res>"
+    "</item>",
+    false, "59", "She Moves", 0, true, false, 0, 0, fileTypeAudio,
+    "Alle Farben", "Car-CD 4", "Pop",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=59&auth=1555278094&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"61\" parentID=\"1\" restricted=\"1\"><dc:title>Cripple and the Starfish</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 6</upnp:album>"
+    "<upnp:artist>Antony and the Johnsons</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:genre>Indie; Alternative</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:04:15.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=61&amp;auth=2068930136&amp;player=6</res>"
+    "</item>",
+    false, "61", "Cripple and the Starfish", 0, true, false, 0, 0, fileTypeAudio,
+    "Antony and the Johnsons", "Car-CD 6", "Indie; Alternative",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=61&auth=2068930136&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"62\" parentID=\"1\" restricted=\"1\"><dc:title>Home</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 5</upnp:album>"
+    "<upnp:artist>Austra</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Pop</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2013-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:04:16.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=62&amp;auth=1838637051&amp;player=6</res>"
+    "</item>",
+    false, "62", "Home", 0, true, false, 0, 0, fileTypeAudio,
+    "Austra", "Car-CD 5", "Pop",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=62&auth=1838637051&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"64\" parentID=\"1\" restricted=\"1\"><dc:title>Lose It</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 5</upnp:album>"
+    "<upnp:artist>Austra</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Indie</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2011-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:04:29.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=64&amp;auth=301348258&amp;player=6</res>"
+    "</item>",
+    false, "64", "Lose It", 0, true, false, 0, 0, fileTypeAudio,
+    "Austra", "Car-CD 5", "Indie",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=64&auth=301348258&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"66\" parentID=\"1\" restricted=\"1\"><dc:title>Keep Moving On - Live</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 6</upnp:album>"
+    "<upnp:artist>Bobo in White Wooden Houses</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2021-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:06:17.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=66&amp;auth=1203305132&amp;player=6</res>"
+    "</item>",
+    false, "66", "Keep Moving On - Live", 0, true, false, 0, 0, fileTypeAudio,
+    "Bobo in White Wooden Houses", "Car-CD 6", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=66&auth=1203305132&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"67\" parentID=\"1\" restricted=\"1\"><dc:title>The Way It Is</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 4</upnp:album>"
+    "<upnp:artist>Bruce Hornsby</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Rock</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2007-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:04:57.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=67&amp;auth=1631389511&amp;player=6</res>"
+    "</item>",
+    false, "67", "The Way It Is", 0, true, false, 0, 0, fileTypeAudio,
+    "Bruce Hornsby", "Car-CD 4", "Rock",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=67&auth=1631389511&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"69\" parentID=\"1\" restricted=\"1\"><dc:title>Enjoy the Silence</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 5</upnp:album>"
+    "<upnp:artist>Carla Bruni</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:03:12.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=69&amp;auth=1422682144&amp;player=6</res>"
+    "</item>",
+    false, "69", "Enjoy the Silence", 0, true, false, 0, 0, fileTypeAudio,
+    "Carla Bruni", "Car-CD 5", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=69&auth=1422682144&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"70\" parentID=\"1\" restricted=\"1\"><dc:title>Clocks</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 4</upnp:album>"
+    "<upnp:artist>Coldplay</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:05:08.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=70&amp;auth=1166330861&amp;player=6</res>"
+    "</item>",
+    false, "70", "Clocks", 0, true, false, 0, 0, fileTypeAudio,
+    "Coldplay", "Car-CD 4", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=70&auth=1166330861&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"71\" parentID=\"1\" restricted=\"1\"><dc:title>Do You Really Want To Hurt Me</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 5</upnp:album>"
+    "<upnp:artist>Culture Club</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:04:20.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=71&amp;auth=2132737601&amp;player=6</res>"
+    "</item>",
+    false, "71", "Do You Really Want To Hurt Me", 0, true, false, 0, 0, fileTypeAudio,
+    "Culture Club", "Car-CD 5", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=71&auth=2132737601&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"73\" parentID=\"1\" restricted=\"1\">"
+    "<dc:title>The Sound Of Silence [Official Music Video]</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 4</upnp:album>"
+    "<upnp:artist>Disturbed</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:04:19.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=73&amp;auth=1764352124&amp;player=6</res>"
+    "</item>",
+    false, "73", "The Sound Of Silence [Official Music Video]", 0, true, false, 0, 0, fileTypeAudio,
+    "Disturbed", "Car-CD 4", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=73&auth=1764352124&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"74\" parentID=\"1\" restricted=\"1\"><dc:title>Working Hard For Your Love</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 5</upnp:album>"
+    "<upnp:artist>Eilen Jewell</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2019-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:03:05.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=74&amp;auth=308302250&amp;player=6</res>"
+    "</item>",
+    false, "74", "Working Hard For Your Love", 0, true, false, 0, 0, fileTypeAudio,
+    "Eilen Jewell", "Car-CD 5", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=74&auth=308302250&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"75\" parentID=\"1\" restricted=\"1\"><dc:title>Vincent</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 5</upnp:album>"
+    "<upnp:artist>Ellie Goulding</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2018-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:03:43.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=75&amp;auth=1881252931&amp;player=6</res>"
+    "</item>",
+    false, "75", "Vincent", 0, true, false, 0, 0, fileTypeAudio,
+    "Ellie Goulding", "Car-CD 5", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=75&auth=1881252931&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"76\" parentID=\"1\" restricted=\"1\"><dc:title>One Of Us Cannot Be Wrong</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 6</upnp:album>"
+    "<upnp:artist>Father John Misty</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Folk</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:07:18.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=76&amp;auth=1587252615&amp;player=6</res>"
+    "</item>",
+    false, "76", "One Of Us Cannot Be Wrong", 0, true, false, 0, 0, fileTypeAudio,
+    "Father John Misty", "Car-CD 6", "Folk",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=76&auth=1587252615&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"77\" parentID=\"1\" restricted=\"1\"><dc:title>Done</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 6</upnp:album>"
+    "<upnp:artist>Frazey Ford</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Folk</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:04:45.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=77&amp;auth=1576011530&amp;player=6</res>"
+    "</item>",
+    false, "77", "Done", 0, true, false, 0, 0, fileTypeAudio,
+    "Frazey Ford", "Car-CD 6", "Folk",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=77&auth=1576011530&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"78\" parentID=\"1\" restricted=\"1\"><dc:title>Why Her Not Me</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 5</upnp:album>"
+    "<upnp:artist>Grace Carter</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:03:53.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=78&amp;auth=2072772819&amp;player=6</res>"
+    "</item>",
+    false, "78", "Why Her Not Me", 0, true, false, 0, 0, fileTypeAudio,
+    "Grace Carter", "Car-CD 5", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=78&auth=2072772819&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"79\" parentID=\"1\" restricted=\"1\"><dc:title>Sign of the Times</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 4</upnp:album>"
+    "<upnp:artist>Harry Styles</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Pop</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2017-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:05:40.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=79&amp;auth=1507833193&amp;player=6</res>"
+    "</item>",
+    false, "79", "Sign of the Times", 0, true, false, 0, 0, fileTypeAudio,
+    "Harry Styles", "Car-CD 4", "Pop",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=79&auth=1507833193&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"80\" parentID=\"1\" restricted=\"1\"><dc:title>Watermelon Sugar</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 6</upnp:album>"
+    "<upnp:artist>Harry Styles</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Pop</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2019-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:03:01.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=80&amp;auth=1090303120&amp;player=6</res>"
+    "</item>",
+    false, "80", "Watermelon Sugar", 0, true, false, 0, 0, fileTypeAudio,
+    "Harry Styles", "Car-CD 6", "Pop",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=80&auth=1090303120&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"81\" parentID=\"1\" restricted=\"1\"><dc:title>Broken</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 5</upnp:album>"
+    "<upnp:artist>Jake Bugg</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Indie</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:04:12.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=81&amp;auth=161778115&amp;player=6</res>"
+    "</item>",
+    false, "81", "Broken", 0, true, false, 0, 0, fileTypeAudio,
+    "Jake Bugg", "Car-CD 5", "Indie",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=81&auth=161778115&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"82\" parentID=\"1\" restricted=\"1\"><dc:title>All Of Me</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 4</upnp:album>"
+    "<upnp:artist>John Legend</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Pop</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2013-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:04:29.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=82&amp;auth=349460798&amp;player=6</res>"
+    "</item>",
+    false, "82", "All Of Me", 0, true, false, 0, 0, fileTypeAudio,
+    "John Legend", "Car-CD 4", "Pop",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=82&auth=349460798&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"83\" parentID=\"1\" restricted=\"1\"><dc:title>Summertime Sadness</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 4</upnp:album>"
+    "<upnp:artist>Lana Del Rey</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Pop</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2012-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:04:25.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=83&amp;auth=2064805328&amp;player=6</res>"
+    "</item>",
+    false, "83", "Summertime Sadness", 0, true, false, 0, 0, fileTypeAudio,
+    "Lana Del Rey", "Car-CD 4", "Pop",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=83&auth=2064805328&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"84\" parentID=\"1\" restricted=\"1\"><dc:title>Slip Away</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 6</upnp:album>"
+    "<upnp:artist>Laurie Anderson</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:genre>Alternative</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:05:50.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=84&amp;auth=73731176&amp;player=6</res>"
+    "</item>",
+    false, "84", "Slip Away", 0, true, false, 0, 0, fileTypeAudio,
+    "Laurie Anderson", "Car-CD 6", "Alternative",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=84&auth=73731176&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"86\" parentID=\"1\" restricted=\"1\"><dc:title>Simple Man</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 5</upnp:album>"
+    "<upnp:artist>Lynyrd Skynyrd</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Rock</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>1973-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:05:59.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=86&amp;auth=263819516&amp;player=6</res>"
+    "</item>",
+    false, "86", "Simple Man", 0, true, false, 0, 0, fileTypeAudio,
+    "Lynyrd Skynyrd", "Car-CD 5", "Rock",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=86&auth=263819516&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"87\" parentID=\"1\" restricted=\"1\"><dc:title>Electric</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 6</upnp:album>"
+    "<upnp:artist>Madrugada</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:04:55.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=87&amp;auth=2106265245&amp;player=6</res>"
+    "</item>",
+    false, "87", "Electric", 0, true, false, 0, 0, fileTypeAudio,
+    "Madrugada", "Car-CD 6", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=87&auth=2106265245&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"89\" parentID=\"1\" restricted=\"1\"><dc:title>Madrugada - Vocal (Live in Norway)</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 6</upnp:album>"
+    "<upnp:artist>Madrugada</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:07:07.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=89&amp;auth=1961870855&amp;player=6</res>"
+    "</item>",
+    false, "89", "Madrugada - Vocal (Live in Norway)", 0, true, false, 0, 0, fileTypeAudio,
+    "Madrugada", "Car-CD 6", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=89&auth=1961870855&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"91\" parentID=\"1\" restricted=\"1\"><dc:title>What's On Your Mind?</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 6</upnp:album>"
+    "<upnp:artist>Madrugada</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Alternative</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:04:02.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=91&amp;auth=635464847&amp;player=6</res>"
+    "</item>",
+    false, "91", "What's On Your Mind?", 0, true, false, 0, 0, fileTypeAudio,
+    "Madrugada", "Car-CD 6", "Alternative",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=91&auth=635464847&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"92\" parentID=\"1\" restricted=\"1\"><dc:title>All This Time</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 4</upnp:album>"
+    "<upnp:artist>Maria Mena</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:03:11.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=92&amp;auth=696084169&amp;player=6</res>"
+    "</item>",
+    false, "92", "All This Time", 0, true, false, 0, 0, fileTypeAudio,
+    "Maria Mena", "Car-CD 4", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=92&auth=696084169&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"94\" parentID=\"1\" restricted=\"1\"><dc:title>Gyöngyhajú lány</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 5</upnp:album>"
+    "<upnp:artist>Omega</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>1969-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:05:47.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=94&amp;auth=1667795562&amp;player=6</res>"
+    "</item>",
+    false, "94", "Gyöngyhajú lány", 0, true, false, 0, 0, fileTypeAudio,
+    "Omega", "Car-CD 5", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=94&auth=1667795562&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"95\" parentID=\"1\" restricted=\"1\"><dc:title>Hell Or High Water</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 5</upnp:album>"
+    "<upnp:artist>Passenger</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:03:40.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=95&amp;auth=1606567683&amp;player=6</res>"
+    "</item>",
+    false, "95", "Hell Or High Water", 0, true, false, 0, 0, fileTypeAudio,
+    "Passenger", "Car-CD 5", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=95&auth=1606567683&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"96\" parentID=\"1\" restricted=\"1\"><dc:title>Born To Be Alive</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 4</upnp:album>"
+    "<upnp:artist>Patrick Hernandez</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:genre>Oldies</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2003-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:03:10.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=96&amp;auth=2034651885&amp;player=6</res>"
+    "</item>",
+    false, "96", "Born To Be Alive", 0, true, false, 0, 0, fileTypeAudio,
+    "Patrick Hernandez", "Car-CD 4", "Oldies",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=96&auth=2034651885&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"97\" parentID=\"1\" restricted=\"1\"><dc:title>Streets Of London</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 4</upnp:album>"
+    "<upnp:artist>Ralph Mctell</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Rock</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2004-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:04:07.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=97&amp;auth=338551257&amp;player=6</res>"
+    "</item>",
+    false, "97", "Streets Of London", 0, true, false, 0, 0, fileTypeAudio,
+    "Ralph Mctell", "Car-CD 4", "Rock",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=97&auth=338551257&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"98\" parentID=\"1\" restricted=\"1\"><dc:title>Jealous Guy</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 4</upnp:album>"
+    "<upnp:artist>Roxy Music</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Rock</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2004-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:04:58.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=98&amp;auth=935060025&amp;player=6</res>"
+    "</item>",
+    false, "98", "Jealous Guy", 0, true, false, 0, 0, fileTypeAudio,
+    "Roxy Music", "Car-CD 4", "Rock",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=98&auth=935060025&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"99\" parentID=\"1\" restricted=\"1\"><dc:title>Youre In The Army</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 5</upnp:album>"
+    "<upnp:artist>Status Quo</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Rock</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res duration=\"0:04:40.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=99&amp;auth=2000616049&amp;player=6</res>"
+    "</item>",
+    false, "99", "Youre In The Army", 0, true, false, 0, 0, fileTypeAudio,
+    "Status Quo", "Car-CD 5", "Rock",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=99&auth=2000616049&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"100\" parentID=\"1\" restricted=\"1\"><dc:title>All You Zombies</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 4</upnp:album>"
+    "<upnp:artist>The Hooters</upnp:artist><upnp:originalTrackNumber/><upnp:genre>Rock</upnp:genre>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2002-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:05:58.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=100&amp;auth=710757102&amp;player=6</res>"
+    "</item>",
+    false, "100", "All You Zombies", 0, true, false, 0, 0, fileTypeAudio,
+    "The Hooters", "Car-CD 4", "Rock",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=100&auth=710757102&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"101\" parentID=\"1\" restricted=\"1\"><dc:title>Save Me</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album>Car-CD 4</upnp:album>"
+    "<upnp:artist>The Parakit feat Alden Jacob</upnp:artist><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=1&amp;auth=687401351&amp;size=300</upnp:albumArtURI>"
+    "<dc:date>2016-01-01</dc:date><dc:description/>"
+    "<res duration=\"0:02:58.0\" protocolInfo=\"http-get:*:audio/mpeg:*\">http://192.168.1.42:4040/stream?id=101&amp;auth=209627580&amp;player=6</res>"
+    "</item>",
+    false, "101", "Save Me", 0, true, false, 0, 0, fileTypeAudio,
+    "The Parakit feat Alden Jacob", "Car-CD 4", "",
+    "http-get:*:audio/mpeg:*",
+    "stream?id=101&auth=209627580&player=6", "192.168.1.42", 4040 },
+  { "<item id=\"119\" parentID=\"2\" restricted=\"1\"><dc:title>EmptyVideoFile</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album/><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=2&amp;auth=80735286&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res protocolInfo=\"http-get:*:video/mp4:*\">http://192.168.1.42:4040/stream?id=119&amp;auth=978603603&amp;player=6&amp;format=raw</res>"
+    "</item>",
+    false, "119", "EmptyVideoFile", 0, true, false, 0, 0, fileTypeAudio,
+    "", "", "",
+    "http-get:*:video/mp4:*",
+    "stream?id=119&auth=978603603&player=6&format=raw", "192.168.1.42", 4040 },
+  { "<item id=\"120\" parentID=\"2\" restricted=\"1\"><dc:title>VideoNr1</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album/><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=2&amp;auth=80735286&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res protocolInfo=\"http-get:*:video/mp4:*\">http://192.168.1.42:4040/stream?id=120&amp;auth=694987397&amp;player=6&amp;format=raw</res>"
+    "</item>",
+    false, "120", "VideoNr1", 0, true, false, 0, 0, fileTypeAudio,
+    "", "", "",
+    "http-get:*:video/mp4:*",
+    "stream?id=120&auth=694987397&player=6&format=raw", "192.168.1.42", 4040 },
+  { "<item id=\"121\" parentID=\"2\" restricted=\"1\"><dc:title>VideoNr2</dc:title>"
+    "<upnp:class>object.item.audioItem.musicTrack</upnp:class><upnp:album/><upnp:originalTrackNumber/>"
+    "<upnp:albumArtURI>http://192.168.1.42:4040/coverArt.view?id=2&amp;auth=80735286&amp;size=300</upnp:albumArtURI>"
+    "<dc:description/>"
+    "<res protocolInfo=\"http-get:*:video/mp4:*\">http://192.168.1.42:4040/stream?id=121&amp;auth=694063876&amp;player=6&amp;format=raw</res>"
+    "</item>",
+    false, "121", "VideoNr2", 0, true, false, 0, 0, fileTypeAudio,
+    "", "", "",
+    "http-get:*:video/mp4:*",
+    "stream?id=121&auth=694063876&player=6&format=raw", "192.168.1.42", 4040 },
+  // BrowseRecursively_WiFi_5-Verbose_MediaPlayer.log
+  { "<container id=\"3\" restricted=\"1\" parentID=\"0\" childCount=\"7\" searchable=\"1\">"
+    "<dc:title>Bilder</dc:title><upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.playlistContainer</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.imageItem.photo</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.photoAlbum</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.storageFolder</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.photoAlbum.dateTaken</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"1\">object.container.album</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"1\">object.item.imageItem</upnp:searchClass></container>",
+    true, "3", "Bilder", 7, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"1\" restricted=\"1\" parentID=\"0\" childCount=\"10\" searchable=\"1\">"
+    "<dc:title>Musik</dc:title><upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"1\">object.item.audioItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.playlistContainer</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"1\">object.container.genre</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.storageFolder</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.genre.musicGenre</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.musicTrack</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.musicAlbum</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.audioBook</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"1\">object.container.album</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.person.musicArtist</upnp:searchClass>"
+    "</container>",
+    true, "1", "Musik", 10, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"2\" restricted=\"1\" parentID=\"0\" childCount=\"8\" searchable=\"1\">"
+    "<dc:title>Videos</dc:title><upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.videoAlbum</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.musicVideoClip</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.videoBroadcast</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.person.movieActor</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"1\">object.container.album</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.movie</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"1\">object.container.genre</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"1\">object.item.videoItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.playlistContainer</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.genre.movieGenre</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.storageFolder</upnp:searchClass></container>",
+    true, "2", "Videos", 8, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"12\" restricted=\"1\" parentID=\"0\" childCount=\"2\" searchable=\"1\">"
+    "<dc:title>Wiedergabelisten</dc:title>"
+    "<upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.musicVideoClip</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.musicTrack</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.imageItem.photo</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.videoBroadcast</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.audioBook</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.movie</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.playlistContainer</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.storageFolder</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.imageItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem</upnp:searchClass></container>",
+    true, "12", "Wiedergabelisten", 2, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"D\" restricted=\"1\" parentID=\"3\" childCount=\"0\" searchable=\"1\">"
+    "<dc:title>Alben</dc:title><upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.imageItem.photo</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.photoAlbum</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"1\">object.container.album</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.imageItem</upnp:searchClass></container>",
+    true, "D", "Alben", 0, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"B\" restricted=\"0\" parentID=\"3\" childCount=\"0\" searchable=\"1\">"
+    "<dc:title>Alle Bilder</dc:title><upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.imageItem.photo</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.photoAlbum</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"1\">object.item.imageItem</upnp:searchClass></container>",
+    true, "B", "Alle Bilder", 0, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"300\" restricted=\"1\" parentID=\"3\" childCount=\"6\" searchable=\"1\">"
+    "<dc:title>Bewertung</dc:title><upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.imageItem.photo</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.photoAlbum</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.storageFolder</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.imageItem</upnp:searchClass></container>",
+    true, "300", "Bewertung", 6, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"C\" restricted=\"1\" parentID=\"3\" childCount=\"0\" searchable=\"1\">"
+    "<dc:title>Bilder aufgenommen am</dc:title>"
+    "<upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.imageItem.photo</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.photoAlbum</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.photoAlbum.dateTaken</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.imageItem</upnp:searchClass></container>",
+    true, "C", "Bilder aufgenommen am", 0, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"11\" restricted=\"1\" parentID=\"3\" childCount=\"0\" searchable=\"1\">"
+    "<dc:title>Bilderwiedergabelisten</dc:title>"
+    "<upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.playlistContainer</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.imageItem.photo</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.photoAlbum</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.imageItem</upnp:searchClass></container>",
+    true, "11", "Bilderwiedergabelisten", 0, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"16\" restricted=\"1\" parentID=\"3\" childCount=\"1\" searchable=\"1\">"
+    "<dc:title>Ordner</dc:title><upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.imageItem.photo</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.photoAlbum</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.storageFolder</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.imageItem</upnp:searchClass></container>",
+    true, "16", "Ordner", 1, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"D2\" restricted=\"1\" parentID=\"3\" childCount=\"0\" searchable=\"1\">"
+    "<dc:title>Schlüsselwörter</dc:title>"
+    "<upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.imageItem.photo</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.photoAlbum</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.imageItem</upnp:searchClass></container>",
+    true, "D2", "Schlüsselwörter", 0, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"7\" restricted=\"1\" parentID=\"1\" childCount=\"9\" searchable=\"1\">"
+    "<dc:title>Alben</dc:title><upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.musicAlbum</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.musicTrack</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"1\">object.container.album</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.audioBook</upnp:searchClass></container>",
+    true, "7", "Alben", 9, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"107\" restricted=\"1\" parentID=\"1\" childCount=\"95\" searchable=\"1\">"
+    "<dc:title>Albuminterpreten</dc:title>"
+    "<upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.musicTrack</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.musicAlbum</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.person.musicArtist</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.audioBook</upnp:searchClass></container>",
+    true, "107", "Albuminterpreten", 95, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"6\" restricted=\"1\" parentID=\"1\" childCount=\"95\" searchable=\"1\">"
+    "<dc:title>Alle Interpreten</dc:title>"
+    "<upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.musicTrack</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.musicAlbum</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.person.musicArtist</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.audioBook</upnp:searchClass></container>",
+    true, "6", "Alle Interpreten", 95, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"4\" restricted=\"0\" parentID=\"1\" childCount=\"114\" searchable=\"1\">"
+    "<dc:title>Alle Musikdateien</dc:title>"
+    "<upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"1\">object.item.audioItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.musicTrack</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.musicAlbum</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.audioBook</upnp:searchClass></container>",
+    true, "4", "Alle Musikdateien", 114, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"101\" restricted=\"1\" parentID=\"1\" childCount=\"5\" searchable=\"1\">"
+    "<dc:title>Bewertung</dc:title><upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.storageFolder</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.musicTrack</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.musicAlbum</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.audioBook</upnp:searchClass></container>",
+    true, "101", "Bewertung", 5, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"5\" restricted=\"1\" parentID=\"1\" childCount=\"18\" searchable=\"1\">"
+    "<dc:title>Genre</dc:title><upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"1\">object.container.genre</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.genre.musicGenre</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.musicTrack</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.musicAlbum</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.audioBook</upnp:searchClass></container>",
+    true, "5", "Genre", 18, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"100\" restricted=\"1\" parentID=\"1\" childCount=\"95\" searchable=\"1\">"
+    "<dc:title>Mitwirkende Interpreten</dc:title>"
+    "<upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.musicTrack</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.musicAlbum</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.person.musicArtist</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.audioBook</upnp:searchClass></container>",
+    true, "100", "Mitwirkende Interpreten", 95, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"F\" restricted=\"1\" parentID=\"1\" childCount=\"0\" searchable=\"1\">"
+    "<dc:title>Musikwiedergabelisten</dc:title>"
+    "<upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.playlistContainer</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.musicTrack</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.musicAlbum</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.audioBook</upnp:searchClass></container>",
+    true, "F", "Musikwiedergabelisten", 0, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"14\" restricted=\"1\" parentID=\"1\" childCount=\"2\" searchable=\"1\">"
+    "<dc:title>Ordner</dc:title><upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.storageFolder</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.musicTrack</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.musicAlbum</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.audioBook</upnp:searchClass></container>",
+    true, "14", "Ordner", 2, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"8\" restricted=\"0\" parentID=\"2\" childCount=\"4\" searchable=\"1\">"
+    "<dc:title>Alle Videos</dc:title><upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.movie</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.musicVideoClip</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"1\">object.item.videoItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.videoBroadcast</upnp:searchClass>"
+    "</container>",
+    true, "8", "Alle Videos", 4, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"200\" restricted=\"1\" parentID=\"2\" childCount=\"5\" searchable=\"1\">"
+    "<dc:title>Bewertung</dc:title><upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.movie</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.musicVideoClip</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.storageFolder</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.videoBroadcast</upnp:searchClass>"
+    "</container>",
+    true, "200", "Bewertung", 5, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"15\" restricted=\"1\" parentID=\"2\" childCount=\"2\" searchable=\"1\">"
+    "<dc:title>Ordner</dc:title><upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.movie</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.musicVideoClip</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.storageFolder</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.videoBroadcast</upnp:searchClass>"
+    "</container>",
+    true, "15", "Ordner", 2, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"E\" restricted=\"1\" parentID=\"2\" childCount=\"3\" searchable=\"1\">"
+    "<dc:title>Serien</dc:title><upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.movie</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.musicVideoClip</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.album.videoAlbum</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.videoBroadcast</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"1\">object.container.album</upnp:searchClass></container>",
+    true, "E", "Serien", 3, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"18\" restricted=\"1\" parentID=\"2\" childCount=\"7\" searchable=\"1\">"
+    "<dc:title>TV-Aufzeichnung</dc:title>"
+    "<upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.playlistContainer</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.movie</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.person.movieActor</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"1\">object.item.videoItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"1\">object.container.genre</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.musicVideoClip</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.storageFolder</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.videoBroadcast</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"1\">object.container.album</upnp:searchClass></container>",
+    true, "18", "TV-Aufzeichnung", 7, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"9\" restricted=\"1\" parentID=\"2\" childCount=\"2\" searchable=\"1\">"
+    "<dc:title>Videogenres</dc:title><upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.movie</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"1\">object.container.genre</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.musicVideoClip</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.videoBroadcast</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.genre.movieGenre</upnp:searchClass>"
+    "</container>",
+    true, "9", "Videogenres", 2, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"A\" restricted=\"1\" parentID=\"2\" childCount=\"1\" searchable=\"1\">"
+    "<dc:title>Videoschauspieler</dc:title>"
+    "<upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.movie</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.person.movieActor</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.musicVideoClip</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.videoBroadcast</upnp:searchClass>"
+    "</container>",
+    true, "A", "Videoschauspieler", 1, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"10\" restricted=\"1\" parentID=\"2\" childCount=\"0\" searchable=\"1\">"
+    "<dc:title>Videowiedergabelisten</dc:title>"
+    "<upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.playlistContainer</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.movie</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.musicVideoClip</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.videoBroadcast</upnp:searchClass>"
+    "</container>",
+    true, "10", "Videowiedergabelisten", 0, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"13\" restricted=\"1\" parentID=\"12\" childCount=\"0\" searchable=\"1\">"
+    "<dc:title>Alle Wiedergabelisten</dc:title>"
+    "<upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.playlistContainer</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.imageItem.photo</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.movie</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.musicVideoClip</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.videoItem.videoBroadcast</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.musicTrack</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.imageItem</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.item.audioItem.audioBook</upnp:searchClass></container>",
+    true, "13", "Alle Wiedergabelisten", 0, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"17\" restricted=\"1\" parentID=\"12\" childCount=\"0\" searchable=\"1\">"
+    "<dc:title>Ordner</dc:title><upnp:class name=\"object.container\">object.container</upnp:class>"
+    "<upnp:writeStatus>NOT_WRITABLE</upnp:writeStatus>"
+    "<upnp:searchClass includeDerived=\"0\">object.container</upnp:searchClass>"
+    "<upnp:searchClass includeDerived=\"0\">object.container.storageFolder</upnp:searchClass></container>",
+    true, "17", "Ordner", 0, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  // BrowseRoot_WiFi_5-Verbose.log
+  { "<container id=\"211\" childCount=\"1\" parentID=\"0\" restricted=\"1\"><dc:title>Videos</dc:title>"
+    "<res xmlns:dlna=\"urn:schemas-dlna-org:metadata-1-0/\" protocolInfo=\"http-get:*:image/jpeg:DLNA.ORG_PN=JPEG_SM;DLNA.ORG_FLAGS=00900000000000000000000000000000\">http://192.168.1.42:5001/get/211/thumbnail0000JPEG_SM_Videos.jpg</res>"
+    "<res xmlns:dlna=\"urn:schemas-dlna-org:metadata-1-0/\" protocolInfo=\"http-get:*:image/jpeg:DLNA.ORG_PN=JPEG_TN;DLNA.ORG_FLAGS=00900000000000000000000000000000\">http://192.168.1.42:5001/get/211/thumbnail0000JPEG_TN_Videos.jpg</res>"
+    "<res xmlns:dlna=\"urn:schemas-dlna-org:metadata-1-0/\" protocolInfo=\"http-get:*:image/png:DLNA.ORG_PN=PNG_LRG;DLNA.ORG_FLAGS=00900000000000000000000000000000\">http://192.168.1.42:5001/get/211/thumbnail0000PNG_LRG_Videos.png</res>"
+    "<res xmlns:dlna=\"urn:schemas-dlna-org:metadata-1-0/\" protocolInfo=\"http-get:*:image/png:DLNA.ORG_PN=PNG_TN;DLNA.ORG_FLAGS=00900000000000000000000000000000\">http://192.168.1.42:5001/get/211/thumbnail0000PNG_TN_Videos.png</res>"
+    "<upnp:albumArtURI dlna:profileID=\"JPEG_SM\" xmlns:dlna=\"urn:schemas-dlna-org:metadata-1-0/\">http://192.168.1.42:5001/get/211/thumbnail0000JPEG_SM_Videos.jpg</upnp:albumArtURI>"
+    "<upnp:albumArtURI dlna:profileID=\"JPEG_TN\" xmlns:dlna=\"urn:schemas-dlna-org:metadata-1-0/\">http://192.168.1.42:5001/get/211/thumbnail0000JPEG_TN_Videos.jpg</upnp:albumArtURI>"
+    "<upnp:albumArtURI dlna:profileID=\"PNG_LRG\" xmlns:dlna=\"urn:schemas-dlna-org:metadata-1-0/\">http://192.168.1.42:5001/get/211/thumbnail0000PNG_LRG_Videos.png</upnp:albumArtURI>"
+    "<upnp:albumArtURI dlna:profileID=\"PNG_TN\" xmlns:dlna=\"urn:schemas-dlna-org:metadata-1-0/\">http://192.168.1.42:5001/get/211/thumbnail0000PNG_TN_Videos.png</upnp:albumArtURI>"
+    "<dc:date>2022-01-13T20:05:26</dc:date><upnp:class>object.container.storageFolder</upnp:class>"
+    "</container>",
+    true, "211", "Videos", 1, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"212\" childCount=\"2\" parentID=\"0\" restricted=\"1\"><dc:title>Web</dc:title>"
+    "<res xmlns:dlna=\"urn:schemas-dlna-org:metadata-1-0/\" protocolInfo=\"http-get:*:image/jpeg:DLNA.ORG_PN=JPEG_SM;DLNA.ORG_FLAGS=00900000000000000000000000000000\">http://192.168.1.42:5001/get/212/thumbnail0000JPEG_SM_Web.jpg</res>"
+    "<res xmlns:dlna=\"urn:schemas-dlna-org:metadata-1-0/\" protocolInfo=\"http-get:*:image/jpeg:DLNA.ORG_PN=JPEG_TN;DLNA.ORG_FLAGS=00900000000000000000000000000000\">http://192.168.1.42:5001/get/212/thumbnail0000JPEG_TN_Web.jpg</res>"
+    "<res xmlns:dlna=\"urn:schemas-dlna-org:metadata-1-0/\" protocolInfo=\"http-get:*:image/png:DLNA.ORG_PN=PNG_LRG;DLNA.ORG_FLAGS=00900000000000000000000000000000\">http://192.168.1.42:5001/get/212/thumbnail0000PNG_LRG_Web.png</res>"
+    "<res xmlns:dlna=\"urn:schemas-dlna-org:metadata-1-0/\" protocolInfo=\"http-get:*:image/png:DLNA.ORG_PN=PNG_TN;DLNA.ORG_FLAGS=00900000000000000000000000000000\">http://192.168.1.42:5001/get/212/thumbnail0000PNG_TN_Web.png</res>"
+    "<upnp:albumArtURI dlna:profileID=\"JPEG_SM\" xmlns:dlna=\"urn:schemas-dlna-org:metadata-1-0/\">http://192.168.1.42:5001/get/212/thumbnail0000JPEG_SM_Web.jpg</upnp:albumArtURI>"
+    "<upnp:albumArtURI dlna:profileID=\"JPEG_TN\" xmlns:dlna=\"urn:schemas-dlna-org:metadata-1-0/\">http://192.168.1.42:5001/get/212/thumbnail0000JPEG_TN_Web.jpg</upnp:albumArtURI>"
+    "<upnp:albumArtURI dlna:profileID=\"PNG_LRG\" xmlns:dlna=\"urn:schemas-dlna-org:metadata-1-0/\">http://192.168.1.42:5001/get/212/thumbnail0000PNG_LRG_Web.png</upnp:albumArtURI>"
+    "<upnp:albumArtURI dlna:profileID=\"PNG_TN\" xmlns:dlna=\"urn:schemas-dlna-org:metadata-1-0/\">http://192.168.1.42:5001/get/212/thumbnail0000PNG_TN_Web.png</upnp:albumArtURI>"
+    "<upnp:class>object.container.storageFolder</upnp:class></container>",
+    true, "212", "Web", 2, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"musicdb://\" parentID=\"0\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Music Library</dc:title><dc:creator>Unknown</dc:creator>"
+    "<dc:publisher>Unknown</dc:publisher><upnp:genre>Unknown</upnp:genre>"
+    "<upnp:episodeSeason>0</upnp:episodeSeason><xbmc:rating>0.0</xbmc:rating>"
+    "<xbmc:userrating>0</xbmc:userrating><upnp:class>object.container</upnp:class></container>",
+    true, "musicdb://", "Music Library", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"library://video/\" parentID=\"0\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Video Library</dc:title><dc:creator>Unknown</dc:creator>"
+    "<dc:publisher>Unknown</dc:publisher><upnp:genre>Unknown</upnp:genre>"
+    "<upnp:episodeSeason>0</upnp:episodeSeason><xbmc:rating>0.0</xbmc:rating>"
+    "<xbmc:userrating>0</xbmc:userrating><upnp:class>object.container</upnp:class></container>",
+    true, "library://video/", "Video Library", 0, true, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"0$1\" parentID=\"0\" restricted=\"1\" childCount=\"11\" searchable=\"1\">"
+    "<dc:title>Music</dc:title><pv:modificationTime>1642257790</pv:modificationTime>"
+    "<upnp:class>object.container</upnp:class></container>",
+    true, "0$1", "Music", 11, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"0$2\" parentID=\"0\" restricted=\"1\" childCount=\"8\" searchable=\"1\">"
+    "<dc:title>Photos</dc:title><pv:modificationTime>1642257791</pv:modificationTime>"
+    "<upnp:class>object.container</upnp:class></container>",
+    true, "0$2", "Photos", 8, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container id=\"0$3\" parentID=\"0\" restricted=\"1\" childCount=\"7\" searchable=\"1\">"
+    "<dc:title>Videos</dc:title><pv:modificationTime>1642257849</pv:modificationTime>"
+    "<upnp:class>object.container</upnp:class></container>",
+    true, "0$3", "Videos", 7, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container restricted=\"1\" searchable=\"1\" childCount=\"6\" id=\"f137a2dd21bbc1b99aa5c0f6bf02a805\" parentID=\"e9d5075a555c1cbc394eec4cef295274\">"
+    "<dc:title>Movies</dc:title><upnp:class>object.container.storageFolder</upnp:class>"
+    "<upnp:albumArtURI dlna:profileID=\"JPEG_SM\">http://192.168.1.42:8096/Items/f137a2dd21bbc1b99aa5c0f6bf02a805/Images/Primary/0/82c951330ab3f44c25ff6fb2a8300b32/jpg/480/480/0/0</upnp:albumArtURI>"
+    "<upnp:icon>http://192.168.1.42:8096/Items/f137a2dd21bbc1b99aa5c0f6bf02a805/Images/Primary/0/82c951330ab3f44c25ff6fb2a8300b32/jpg/48/48/0/0</upnp:icon>"
+    "<res protocolInfo=\"http-get:*:image/jpeg:DLNA.ORG_PN=JPEG_LRG;DLNA.ORG_OP=00;DLNA.ORG_CI=0;DLNA.ORG_FLAGS=00D00000000000000000000000000000\" resolution=\"960x540\">http://192.168.1.42:8096/Items/f137a2dd21bbc1b99aa5c0f6bf02a805/Images/Primary/0/82c951330ab3f44c25ff6fb2a8300b32/jpg/4096/4096/0/0</res>"
+    "<res protocolInfo=\"http-get:*:image/jpeg:DLNA.ORG_PN=JPEG_MED;DLNA.ORG_OP=00;DLNA.ORG_CI=0;DLNA.ORG_FLAGS=00D00000000000000000000000000000\" resolution=\"960x540\">http://192.168.1.42:8096/Items/f137a2dd21bbc1b99aa5c0f6bf02a805/Images/Primary/0/82c951330ab3f44c25ff6fb2a8300b32/jpg/1024/768/0/0</res>"
+    "<res protocolInfo=\"http-get:*:image/jpeg:DLNA.ORG_PN=JPEG_SM;DLNA.ORG_OP=00;DLNA.ORG_CI=0;DLNA.ORG_FLAGS=00D00000000000000000000000000000\" resolution=\"640x360\">http://192.168.1.42:8096/Items/f137a2dd21bbc1b99aa5c0f6bf02a805/Images/Primary/0/82c951330ab3f44c25ff6fb2a8300b32/jpg/640/480/0/0</res>"
+    "<res protocolInfo=\"http-get:*:image/png:DLNA.ORG_PN=PNG_LRG;DLNA.ORG_OP=00;DLNA.ORG_CI=0;DLNA.ORG_FLAGS=00D00000000000000000000000000000\" resolution=\"960x540\">http://192.168.1.42:8096/Items/f137a2dd21bbc1b99aa5c0f6bf02a805/Images/Primary/0/82c951330ab3f44c25ff6fb2a8300b32/png/4096/4096/0/0</res>"
+    "<res protocolInfo=\"http-get:*:image/png:DLNA.ORG_PN=PNG_TN;DLNA.ORG_OP=00;DLNA.ORG_CI=0;DLNA.ORG_FLAGS=00D00000000000000000000000000000\" resolution=\"160x90\">http://192.168.1.42:8096/Items/f137a2dd21bbc1b99aa5c0f6bf02a805/Images/Primary/0/82c951330ab3f44c25ff6fb2a8300b32/png/160/160/0/0</res>"
+    "<res protocolInfo=\"http-get:*:image/jpeg:DLNA.ORG_PN=JPEG_TN;DLNA.ORG_OP=00;DLNA.ORG_CI=0;DLNA.ORG_FLAGS=00D00000000000000000000000000000\" resolution=\"160x90\">http://192.168.1.42:8096/Items/f137a2dd21bbc1b99aa5c0f6bf02a805/Images/Primary/0/82c951330ab3f44c25ff6fb2a8300b32/jpg/160/160/0/0</res>"
+    "</container>",
+    true, "f137a2dd21bbc1b99aa5c0f6bf02a805", "Movies", 6, false, true, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container childCount=\"10\" id=\"A\" parentID=\"0\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Audio</dc:title><upnp:class>object.container</upnp:class></container>",
+    true, "A", "Audio", 10, false, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container childCount=\"5\" id=\"I\" parentID=\"0\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Image</dc:title><upnp:class>object.container</upnp:class></container>",
+    true, "I", "Image", 5, false, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 },
+  { "<container childCount=\"7\" id=\"V\" parentID=\"0\" restricted=\"1\" searchable=\"0\">"
+    "<dc:title>Video</dc:title><upnp:class>object.container</upnp:class></container>",
+    true, "V", "Video", 7, false, false, 0, 0, fileTypeOther, "", "", "", "", "", "", 0 }
+};
+
+#define CORPUS_OBJECTS        (sizeof(corpus) / sizeof(corpusObject_t))
@@ -0,0 +1,141 @@
+/*
+  BrowseAsync_WiFi
+
+  This sketch scans the local network for DLNA media servers via builtin WiFi and browses
+  root of each server found, both without blocking.
+
+  seekServerAsync() only sends the SSDP M-SEARCH, poll() evaluates the answers and reports the
+  end of seeking to a callback. browseServerAsync() only sends the request (or starts connecting). The reply gets evaluated by poll(), which is
+  called from loop() and never waits for data. Objects are handed over to a callback as soon
+  as they are scanned, a second callback reports the end of browsing. Meanwhile loop() is free
+  for other work, here it just counts its rounds (think of UI or audio handling instead).
+
+  Last updated 2026-10-17, ThJ <yellobyte@bluewin.ch>
+*/
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include "SoapESP32.h"
+
+// With build option 'SHOW_ESP32_MEMORY_STATISTICS' the sketch prints ESP32 memory stats when finished.
+// The option has already been added to the provided file 'build_opt.h'. Please use it with ArduinoIDE.
+// Have a look at Readme.md for more detailed info about setting build options.
+
+const char ssid[] = "MySSID";
+const char pass[] = "MyPassword";
+
+WiFiClient client;
+WiFiUDP    udp;
+
+SoapESP32 soap(&client, &udp);
+
+bool seeking = true;                  // seeking media servers in progress
+unsigned int server = 0;              // server currently browsed
+unsigned int objects = 0;             // objects reported so far
+unsigned long rounds = 0;             // loop() rounds while browsing
+
+// called by poll() when seeking media servers has finished
+void seekDone(unsigned int servers, void *arg)
+{
+  Serial.print("Number of discovered servers that deliver content: ");
+  Serial.println(servers);
+  Serial.println();
+  seeking = false;
+}
+
+// called by poll() for each object in root
+bool printObject(const soapObject_t *object, void *arg)
+{
+  Serial.print(" ");
+  Serial.print(object->name);
+  Serial.println(object->isDirectory ? " (directory)" : " (item)");
+  objects++;
+
+  return true;                        // false would stop browsing
+}
+
+// called by poll() when browsing has finished
+void browseDone(bool ok, const soapPageInfo_t *page, void *arg)
+{
+  if (!ok) {
+    Serial.println("error browsing server.");
+  }
+  else {
+    Serial.print(objects);
+    Serial.print(" objects, ");
+    Serial.print(rounds);
+    Serial.println(" loop() rounds while browsing.");
+  }
+  Serial.println("");
+  server++;
+}
+
+// start browsing root of next server, returns false if there's none left
+bool browseNext()
+{
+  soapServer_t serv;
+
+  while (soap.getServerInfo(server, &serv)) {
+    Serial.print("Server[");
+    Serial.print(server);
+    Serial.print("]: ");
+    Serial.print(serv.friendlyName);
+    Serial.println(", root directory:");
+    objects = 0;
+    rounds = 0;
+    // browse root (always represented by "0" according to SOAP spec)
+    if (soap.browseServerAsync(server, "0", printObject, browseDone)) return true;
+    Serial.println("error sending request.");
+    server++;
+  }
+
+  return false;
+}
+
+void setup() {
+  Serial.begin(115200);
+
+  // connect to local network via WiFi
+  Serial.println();
+  Serial.print("Connecting to WiFi network ");
+  WiFi.begin(ssid, pass);
+  while ( WiFi.status() != WL_CONNECTED) {
+    Serial.print(".");
+    delay(500);
+  }
+  Serial.println();
+  Serial.print("Connected successfully. IP address: ");
+  Serial.println(WiFi.localIP());
+
+  // scan local network for DLNA media servers
+  Serial.println();
+  Serial.println("Scanning local network for DLNA media servers...");
+  // scan duration set to 20 sec, stop when no new server answered within 3 sec
+  soapSeekUntil_t until = { .servers = 0, .friendlyName = NULL, .udn = NULL, .quietPeriod = 3000 };
+  if (!soap.seekServerAsync(&until, NULL, seekDone, NULL, 20)) seeking = false;
+}
+
+void loop() {
+  static bool finished = false;
+
+  if (soap.poll()) {
+    // seeking/browsing in progress, other work can be done here
+    rounds++;
+    return;
+  }
+  if (seeking) return;
+  if (finished || browseNext()) return;
+
+  finished = true;
+#ifdef SHOW_ESP32_MEMORY_STATISTICS
+  Serial.println("Some ESP32 memory stats after running this sketch:");
+  Serial.print(" 1) minimum ever free memory of all regions [in bytes]: ");
+  Serial.println(ESP.getMinFreeHeap());
+  Serial.print(" 2) minimum ever free heap size [in bytes]:             ");
+  Serial.println(xPortGetMinimumEverFreeHeapSize());
+  Serial.print(" 3) minimum ever stack size of this task [in bytes]:    ");
+  Serial.println(uxTaskGetStackHighWaterMark(NULL));
+#endif
+  Serial.println();
+  Serial.println("Sketch finished.");
+}
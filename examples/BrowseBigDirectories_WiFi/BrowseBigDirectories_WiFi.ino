@@ -9,10 +9,13 @@
   Increasing this parameter means using more memory.	
 
   The sketch scans the network for media servers and if found, browses each server for a big directory.
-  If found the sketch browses that directory multiple times, each time with a higher starting 
-  index: 0, 100, 200, etc. until all items in that directory have been printed.
+  If found the sketch browses that directory page by page (100 entries each) with browseStart() and
+  nextPage() until all items in that directory have been printed. The number of pages is derived
+  from the servers reply (TotalMatches), so it works with servers not reporting the child count 
+  of directories as well. The request for the next page is already sent while the current page 
+  gets printed.
     
-  Last updated 2023-11-29, ThJ <yellobyte@bluewin.ch>
+  Last updated 2026-10-17, ThJ <yellobyte@bluewin.ch>
 */
 
 #include <Arduino.h>
@@ -108,61 +111,57 @@ void setup() {
   soapObject_t     directory;
   soapObjectVect_t directoryContent;
   soapServer_t     srvInfo;
+  soapCursor_t     cursor;
   unsigned int srvNum = 0,         // start with first server in list
-               startingIndex;
+               index;
 
   while (soap.getServerInfo(srvNum, &srvInfo)) {
     // Scan each server
     Serial.print("Please be patient, searching big directory on server: ");
     Serial.println(srvInfo.friendlyName);
     
-    startingIndex = 0;             // start browsing a directory with offset 0
     directory.id = "0";            // start with root ("0")
     directory.name = "root";       // only needed for printing in case of error
     
     if (findBigDirectory(&soap, srvNum, &directory)) {
       // found big directory, now print entire content 
-      while (startingIndex < directory.size) {
+      soap.browseStart(srvNum, directory.id.c_str(), &cursor);
+      index = 0;
+      while (!cursor.done) {
         Serial.print("------> Browse directory with starting index: ");
-        Serial.println(startingIndex);
-        // browse directory with increasing starting index
-        if (!soap.browseServer(srvNum, directory.id.c_str(), 
-                               &directoryContent, startingIndex) ||
-            directoryContent.size() == 0) {
-          // function returned error or directory is empty    
+        Serial.println(cursor.startingIndex);
+        // browse directory page by page
+        if (!soap.nextPage(&cursor, &directoryContent)) {
+          // function returned error
           Serial.print("Error browsing directory with name: ");
           Serial.println(directory.name);
           break;
         }
-        else {
-          // show all entries in list
-          for (unsigned int i = 0; i < directoryContent.size(); i++) {
-            // print object count
-            Serial.print(startingIndex + i);
-            Serial.print(": ");
-            // print name of object
-            Serial.print(directoryContent[i].name);
-            if (directoryContent[i].isDirectory ) {
-              // directory: append '/' to name
-              Serial.println("/");
-            } 
+        // show all entries in list
+        for (unsigned int i = 0; i < directoryContent.size(); i++) {
+          // print object count
+          Serial.print(index++);
+          Serial.print(": ");
+          // print name of object
+          Serial.print(directoryContent[i].name);
+          if (directoryContent[i].isDirectory ) {
+            // directory: append '/' to name
+            Serial.println("/");
+          } 
+          else {
+            // item: append item type and size
+            Serial.print("   ");
+            Serial.print("item size: ");
+            if (directoryContent[i].sizeMissing) {
+              Serial.print("missing");
+            }
             else {
-              // item: append item type and size
-              Serial.print("   ");
-              Serial.print("item size: ");
-              if (directoryContent[i].sizeMissing) {
-                Serial.print("missing");
-              }
-              else {
-                Serial.print(directoryContent[i].size, DEC);
-              }
-              Serial.print(", ");
-              Serial.println(soap.getFileTypeName(directoryContent[i].fileType));
+              Serial.print(directoryContent[i].size, DEC);
             }
+            Serial.print(", ");
+            Serial.println(soap.getFileTypeName(directoryContent[i].fileType));
           }
-          // increase index to get next chunk
-          startingIndex += directoryContent.size();
-        }  
+        }
       }
       break;
     }
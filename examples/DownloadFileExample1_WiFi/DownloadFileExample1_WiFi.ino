@@ -6,9 +6,12 @@
   The parameters needed for download must be set manually further down. You find 
   a snapshot in directory doc, showing you how to use VLC to find proper values.
 
+  If the download gets interrupted (e.g. WiFi drop) it is resumed where it stopped, 
+  provided the media server supports HTTP ranges.
+
   Chip Select (CS) Signal of SD card module/shield is attached to GPIO 10.
     
-  Last updated 2024-11-21, ThJ <yellobyte@bluewin.ch>
+  Last updated 2026-10-17, ThJ <yellobyte@bluewin.ch>
 */
 
 #include <Arduino.h>
@@ -31,6 +34,7 @@ const char pass[] = "MyPassword";
 // File download settings
 #define FILE_NAME_ON_SD    "/myFile.mp3"
 #define READ_BUFFER_SIZE   5000
+#define RESUME_ATTEMPTS    3
 
 #define GPIO_SDCS   10
 
@@ -77,7 +81,9 @@ void setup() {
 
   size_t fileSize;          // file size announced by server
   uint32_t bytesRead;       // read count
+  int resumes = 0;          // download resumed after read error
   soapObject_t object;      // holds all necessary infos for download
+  soapRange_t range;        // result of resuming
 
   object.isDirectory  = false;
   object.downloadIp   = IPAddress(FILE_DOWNLOAD_IP);
@@ -99,8 +105,18 @@ void setup() {
     do {
       int res = soap.read(buffer, READ_BUFFER_SIZE);
       if (res < 0) {
-        // read error  
-        break;
+        // read error, resume download at current position
+        soap.readStop();
+        if (resumes++ == RESUME_ATTEMPTS) break;
+        Serial.println();
+        Serial.print("Read error, resuming download at ");
+        Serial.println(bytesRead);
+        delay(1000);
+        if (!soap.readStart(&object, bytesRead, fileSize - bytesRead, &range)) {
+          if (range.status == rangeIgnored) Serial.println("Server doesn't support resuming.");
+          break;
+        }
+        continue;
       }         
       else if (res > 0) {
         // Remark: At this point instead of writing to SD card you could write the data 
@@ -6,12 +6,13 @@
   
   The difference is that we create more than one thread and use a project
   wide mutex lock to avoid problems as explained in Readme.md. 
-  This example gives you an idea how to do it.
+  This example gives you an idea how to do it. The library's usage of the 
+  SPI bus is printed after each browse, useful when tuning bus sharing.
   
   We use a Wiznet W5x00 Ethernet module/shield instead of builtin WiFi.
   It's connected to ESP32 GPIO 18, 19, 23 and GPIO 25 (Chip Select).
 
-  Last updated 2023-11-22, ThJ <yellobyte@bluewin.ch>
+  Last updated 2026-10-17, ThJ <yellobyte@bluewin.ch>
 */
 
 #include <Arduino.h>
@@ -108,6 +109,7 @@ void setup() {
   // Show root content of all discovered, usable media servers
   soapObjectVect_t browseResult;         // browse results get stored here
   soapServer_t serv;                     // single server info gets stored here
+  soapSPIStats_t spi;                    // SPI bus usage of library gets stored here
   unsigned int i = 0;                    // start with first entry in server list
 
   while (soap.getServerInfo(i, &serv)) {
@@ -122,6 +124,7 @@ void setup() {
     Serial.println(serv.friendlyName);
 
     // browse root (always represented by "0" according to spec)
+    soap.getSPIStats(&spi, true);        // reset counters
     if (!soap.browseServer(i, "0", &browseResult)) {
       Serial.println("error browsing server.");
     }
@@ -150,6 +153,10 @@ void setup() {
 
       }
     }
+    // SPI bus usage of library during browse
+    soap.getSPIStats(&spi);
+    Serial.printf("SPI bus taken %u times, waited %llu us (max. %u us), held %llu us (max. %u us)\n",
+                  spi.acquisitions, spi.waitUs, spi.maxWaitUs, spi.holdUs, spi.maxHoldUs);
     Serial.println("");
     i++;
   }
@@ -10,6 +10,41 @@
 
 #include "MiniXPath.h"
 
+// SWAR (word-at-a-time): top bit of a byte gets set for bytes being 0 / less than n, a word without 
+// any top bit set holds no such byte (bits above the first one set can be false hits)
+#define XML_SWAR_ONES        0x01010101u
+#define XML_SWAR_HIGHS       0x80808080u
+#define xmlSwarZero(x)       (((x) - XML_SWAR_ONES) & ~(x) & XML_SWAR_HIGHS)
+#define xmlSwarLess(x, n)    (((x) - XML_SWAR_ONES * (n)) & ~(x) & XML_SWAR_HIGHS)
+
+//
+// find next quote character (with controls also next control character incl. whitespace)
+// word-at-a-time, returns end if there is none
+//
+static const char *xmlFindQuote(const char *p, const char *end, char quote, bool controls)
+{
+  uint32_t pattern = XML_SWAR_ONES * (uint8_t)quote, w;
+
+  while (end - p >= (int)sizeof(w)) {
+    memcpy(&w, p, sizeof(w));
+    if (xmlSwarZero(w ^ pattern) || (controls && xmlSwarLess(w, 0x20))) break;
+    p += sizeof(w);
+  }
+  while (p < end && *p != quote && !(controls && (uint8_t)*p < 0x20)) p++;
+
+  return p;
+}
+
+//
+// find next character c, returns end if there is none
+//
+static const char *xmlFind(const char *p, const char *end, char c)
+{
+  const char *found = (const char *)memchr(p, c, end - p);
+
+  return found ? found : end;
+}
+
 MiniXPath::MiniXPath()
 {
   pathSize = 0;
@@ -276,3 +311,266 @@ bool MiniXPath::elementPathMatch()
          (sub ? true : (tagLevel - subLevel < pathSize)) &&
          (matchCount == strlen(path[matchLevel]));
 }
+
+MiniXPathSet::MiniXPathSet()
+{
+  pathCount = 0;
+  skipCount = 0;
+  reset();
+}
+
+void MiniXPathSet::reset()
+{
+  state = XML_PARSER_ROOT;
+  tagLevel = 0;
+  quote = 0;
+  nameLength = 0;
+  capture = -1;
+  captureLevel = 0xFF;
+  skipping = false;
+  tagStart = 0;
+  for (uint8_t i = 0; i < pathCount; i++) {
+    anchor[i] = 0;
+    matchLevel[i] = 0;
+  }
+}
+
+bool MiniXPathSet::addPath(const xPathParser_t *path, bool sub)
+{
+  if (pathCount >= XML_PATHSET_MAX_PATHS) return false;
+  paths[pathCount] = path;
+  subTree[pathCount] = sub;
+  anchor[pathCount] = 0;
+  matchLevel[pathCount] = 0;
+  pathCount++;
+  return true;
+}
+
+// elements named tagName directly inside a captured sub tree are left out of the value, except
+// for the first keep ones
+bool MiniXPathSet::addSkip(const char *tagName, uint8_t keep)
+{
+  if (skipCount >= XML_PATHSET_MAX_SKIPS) return false;
+  skipName[skipCount] = tagName;
+  skipKeep[skipCount] = keep;
+  skipSeen[skipCount] = 0;
+  skipCount++;
+  return true;
+}
+
+// returns index of path (in order of addPath() calls) whose value is complete, -1 otherwise
+int MiniXPathSet::getValue(char charToParse, String *result, String *attrib)
+{
+  int ret = -1;
+  bool tree = (capture >= 0 && subTree[capture] && tagLevel >= captureLevel && !skipping);
+
+  // whole sub tree requested: everything inside the captured element is taken
+  if (tree) *result += charToParse;
+
+  switch (state) {
+    case XML_PARSER_ROOT:
+    case XML_PARSER_ELEMENT_CONTENT:
+      if (charToParse == '<') {
+        if (tree) tagStart = result->length() - 1;
+        state = XML_PARSER_START_TAG;
+      }
+      else if (capture >= 0 && !subTree[capture] && tagLevel == captureLevel) {
+        // element content only, sub elements are ignored
+        *result += charToParse;
+      }
+      break;
+    case XML_PARSER_START_TAG:
+      if (charToParse == '/') {
+        if (capture >= 0 && tagLevel == captureLevel) {
+          // end tag of captured element
+          if (subTree[capture] && result->endsWith("</")) result->remove(result->length() - 2);
+          result->trim();
+          ret = capture;
+          capture = -1;
+          captureLevel = 0xFF;
+        }
+        state = XML_PARSER_END_TAG;
+      }
+      else if (charToParse == '!' || charToParse == '?') {
+        // comments, prolog, etc. are skipped
+        state = XML_PARSER_COMMENT;
+      }
+      else {
+        name[0] = charToParse;
+        nameLength = 1;
+        state = XML_PARSER_START_TAG_NAME;
+      }
+      break;
+    case XML_PARSER_START_TAG_NAME:
+      if (charToParse != '>' && charToParse != '/' && 
+          charToParse != ' ' && charToParse != '\t' && charToParse != '\r' && charToParse != '\n') {
+        if (nameLength < sizeof(name) - 1) {
+          name[nameLength++] = charToParse;
+        }
+        else {
+          nameLength = sizeof(name);       // too long, can't match
+        }
+        break;
+      }
+      nameEnd(result, attrib);
+      state = XML_PARSER_ATTRIBUTES;
+      // tag name directly followed by '>' or "/>" gets handled as attribute end
+      if (charToParse != '>' && charToParse != '/') break;
+      // fall through
+    case XML_PARSER_ATTRIBUTES:
+      if (charToParse == '>') {
+        openTag(result);
+        state = XML_PARSER_ELEMENT_CONTENT;
+      }
+      else if (charToParse == '/') {
+        // empty element
+        openTag(result);
+        if (capture >= 0 && tagLevel == captureLevel) {
+          ret = capture;
+          capture = -1;
+          captureLevel = 0xFF;
+        }
+        state = XML_PARSER_END_TAG;
+      }
+      else {
+        if (charToParse == '"' || charToParse == '\'') {
+          quote = charToParse;
+          state = XML_PARSER_ATTRIBUTE_VALUE;
+        }
+        if (attrib && capture >= 0 && captureLevel == 0xFF) {
+          *attrib += (charToParse == '\t' || charToParse == '\r' || charToParse == '\n') ? ' ' : charToParse;
+        }
+      }
+      break;
+    case XML_PARSER_ATTRIBUTE_VALUE:
+      if (charToParse == quote) state = XML_PARSER_ATTRIBUTES;
+      if (attrib && capture >= 0 && captureLevel == 0xFF) {
+        *attrib += (charToParse == '\t' || charToParse == '\r' || charToParse == '\n') ? ' ' : charToParse;
+      }
+      break;
+    case XML_PARSER_END_TAG:
+      if (charToParse == '>') {
+        closeTag();
+        state = XML_PARSER_ELEMENT_CONTENT;
+      }
+      break;
+    case XML_PARSER_COMMENT:
+      if (charToParse == '>') state = (tagLevel == 0) ? XML_PARSER_ROOT : XML_PARSER_ELEMENT_CONTENT;
+      break;
+  }
+
+  return ret;
+}
+
+// block variant of getValue(): takes characters until a value is complete or data is used up, 
+// *used returns the number of characters taken
+int MiniXPathSet::getValue(const char *data, size_t size, size_t *used, String *result, String *attrib)
+{
+  const char *p = data, *end = data + size, *run;
+  int ret = -1;
+
+  while (p < end && ret < 0) {
+    bool tree = (capture >= 0 && subTree[capture] && tagLevel >= captureLevel && !skipping);
+    bool attr = (attrib && capture >= 0 && captureLevel == 0xFF);
+
+    // a run of characters that don't change the state is taken as a whole
+    switch (state) {
+      case XML_PARSER_ROOT:
+      case XML_PARSER_ELEMENT_CONTENT:
+        run = xmlFind(p, end, '<');
+        if (run > p && (tree || (capture >= 0 && !subTree[capture] && tagLevel == captureLevel))) {
+          result->concat(p, run - p);
+        }
+        break;
+      case XML_PARSER_ATTRIBUTE_VALUE:
+        // whitespace in attributes collected gets replaced, left to single character parsing
+        run = xmlFindQuote(p, end, quote, attr);
+        if (run > p && tree) result->concat(p, run - p);
+        if (run > p && attr) attrib->concat(p, run - p);
+        break;
+      case XML_PARSER_END_TAG:
+      case XML_PARSER_COMMENT:
+        run = xmlFind(p, end, '>');
+        if (run > p && tree) result->concat(p, run - p);
+        break;
+      default:
+        run = p;
+        break;
+    }
+    p = run;
+    if (p < end) ret = getValue(*p++, result, attrib);
+  }
+  *used = p - data;
+
+  return ret;
+}
+
+// tag name complete: advance all paths waiting for an element at this level
+void MiniXPathSet::nameEnd(String *result, String *attrib)
+{
+  name[nameLength < sizeof(name) ? nameLength : 0] = 0;
+  for (uint8_t i = 0; i < pathCount; i++) {
+    const xPathParser_t *p = paths[i];
+    if (matchLevel[i] >= p->num) continue;
+    if (matchLevel[i] == 0) {
+      if ((!p->sub && tagLevel != 0) || !nameMatch(p->tagNames[0])) continue;
+      anchor[i] = tagLevel;
+      matchLevel[i] = 1;
+    }
+    else if (anchor[i] + matchLevel[i] == tagLevel && nameMatch(p->tagNames[matchLevel[i]])) {
+      matchLevel[i]++;
+    }
+    else {
+      continue;
+    }
+    if (matchLevel[i] == p->num && capture < 0) {
+      // this element completes the path, collect its attributes & value
+      capture = i;
+      captureLevel = 0xFF;             // set when start tag is complete
+      if (attrib) *attrib = "";
+    }
+  }
+
+  // element of no interest directly inside captured sub tree: taken out again, rest gets skipped
+  if (capture >= 0 && subTree[capture] && tagLevel == captureLevel && !skipping) {
+    for (uint8_t i = 0; i < skipCount; i++) {
+      if (!nameMatch(skipName[i])) continue;
+      if (skipSeen[i] < skipKeep[i]) {
+        skipSeen[i]++;
+      }
+      else {
+        result->remove(tagStart);
+        skipping = true;
+      }
+      break;
+    }
+  }
+}
+
+void MiniXPathSet::openTag(String *result)
+{
+  tagLevel++;
+  if (capture >= 0 && captureLevel == 0xFF) {
+    captureLevel = tagLevel;
+    *result = "";
+    for (uint8_t i = 0; i < skipCount; i++) skipSeen[i] = 0;
+  }
+}
+
+void MiniXPathSet::closeTag()
+{
+  if (tagLevel == 0) return;
+  tagLevel--;
+  if (skipping && tagLevel == captureLevel) skipping = false;
+  for (uint8_t i = 0; i < pathCount; i++) {
+    if (matchLevel[i] > 0 && anchor[i] + matchLevel[i] - 1 == tagLevel) matchLevel[i]--;
+  }
+}
+
+// compares local names, namespace prefixes are ignored on both sides
+bool MiniXPathSet::nameMatch(const char *tagName)
+{
+  const char *local = strchr(tagName, ':'), *parsed = strchr(name, ':');
+
+  return strcmp(local ? local + 1 : tagName, parsed ? parsed + 1 : name) == 0;
+}
@@ -30,6 +30,10 @@
 
 #define XML_PROLOG "xml"
 
+#define XML_PATHSET_MAX_PATHS              6  // max number of paths tracked by MiniXPathSet
+#define XML_PATHSET_NAME_SIZE             40  // longer tag names never match
+#define XML_PATHSET_MAX_SKIPS              4  // max number of elements left out of captured sub trees
+
 struct xPathParser_t
 { 
   const bool    sub;           // true if path starts not with root element
@@ -63,4 +67,51 @@ class MiniXPath {
     bool elementPathMatch();
 };
 
+//
+// MiniXPathSet tracks a whole set of paths in a single pass over the XML stream and
+// reports which path delivered a value. Namespace prefixes are treated as wildcards, 
+// e.g. path element "u:BrowseResponse" matches <BrowseResponse>, <u:BrowseResponse> 
+// and <m:BrowseResponse>.
+// Elements of no interest inside a captured sub tree (e.g. <desc>) can be left out of the
+// value with addSkip(). Feeding whole blocks of characters is much faster than single ones,
+// runs of characters without meaning for the parser (element text, attribute values) are 
+// found word-at-a-time and taken as a whole.
+//
+class MiniXPathSet {
+  public:
+    uint8_t state;
+
+    MiniXPathSet();
+
+    void reset();
+    bool addPath(const xPathParser_t *path, bool subTree = false);
+    bool addSkip(const char *tagName, uint8_t keep = 0);
+    int  getValue(char charToParse, String *result, String *attrib = NULL);
+    int  getValue(const char *data, size_t size, size_t *used, String *result, String *attrib = NULL);
+
+  private:
+    const xPathParser_t *paths[XML_PATHSET_MAX_PATHS];
+    bool       subTree[XML_PATHSET_MAX_PATHS];     // true: whole sub tree of path is requested
+    uint8_t    anchor[XML_PATHSET_MAX_PATHS];      // tag level of first path element match
+    uint8_t    matchLevel[XML_PATHSET_MAX_PATHS];  // number of path elements matched so far
+    uint8_t    pathCount;
+    uint8_t    tagLevel;       // current tag level (number of open elements)
+    char       quote;          // quote character of current attribute value
+    char       name[XML_PATHSET_NAME_SIZE];
+    uint8_t    nameLength;
+    int8_t     capture;        // path whose value is currently collected, -1 if none
+    uint8_t    captureLevel;   // tag level inside the captured element
+    const char *skipName[XML_PATHSET_MAX_SKIPS];
+    uint8_t    skipKeep[XML_PATHSET_MAX_SKIPS];    // number of elements kept before skipping starts
+    uint8_t    skipSeen[XML_PATHSET_MAX_SKIPS];    // elements found in current sub tree
+    uint8_t    skipCount;
+    bool       skipping;       // inside an element left out of the captured sub tree
+    unsigned int tagStart;     // length of captured sub tree before current tag
+
+    void nameEnd(String *result, String *attrib);
+    void openTag(String *result);
+    void closeTag();
+    bool nameMatch(const char *tagName);
+};
+
 #endif
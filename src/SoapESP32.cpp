@@ -23,70 +23,336 @@
   WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 */
 
+#include <new>
+#include <atomic>
+#include <esp_task_wdt.h>
+#include <esp_idf_version.h>
 #include "SoapESP32.h"
+#ifndef USE_ETHERNET
+#include <lwip/sockets.h>
+#endif
 #include "MiniXPath.h"
 
 #ifdef USE_ETHERNET
 // usage of Wiznet W5x00 Ethernet board/shield instead of builtin WiFi
-#define claimSPI()   if (m_SPIsem && *m_SPIsem) while (xSemaphoreTake(*m_SPIsem, 10) != pdTRUE)
-#define releaseSPI() if (m_SPIsem && *m_SPIsem) xSemaphoreGive(*m_SPIsem)
+// the SPI bus is shared with other devices via semaphore, each bus access gets counted & timed
+#define claimSPI()   soapClaimSPI()
+#define releaseSPI() soapReleaseSPI()
+// nothing received yet: leave the bus to other devices for a while before polling again
+#define idleSPI()    if (m_SPIsem && *m_SPIsem) delay(1)
 #else
 // usage of builtin WiFi
 #define claimSPI()
 #define releaseSPI() 
+#define idleSPI()
+#endif
+
+#ifdef SOAP_REQUEST_STATS
+// timing breakdown & counters of each request, see getLastRequestStats()
+#define statsStart()         soapStatsStart()
+#define statsEnd()           soapStatsEnd()
+#define statsReceived(len)   soapStatsReceived(len)
+#define statsTime(step)      m_reqStats.step = micros() - m_reqStart
+#define statsSet(field, val) m_reqStats.field = (val)
+#define statsAdd(field, val) m_reqStats.field += (val)
+#define statsScanStart()     m_reqScanStart = micros()
+#define statsScanEnd()       m_reqStats.scanUs += micros() - m_reqScanStart
+#else
+#define statsStart()         do {} while (0)
+#define statsEnd()           do {} while (0)
+#define statsReceived(len)   do {} while (0)
+#define statsTime(step)      do {} while (0)
+#define statsSet(field, val) do {} while (0)
+#define statsAdd(field, val) do {} while (0)
+#define statsScanStart()     do {} while (0)
+#define statsScanEnd()       do {} while (0)
 #endif
 
+// result of evaluating a SSDP packet
+enum eSsdpPacket { ssdpNone = 0, ssdpIgnored, ssdpNewServer, ssdpError };
+
 enum eXpath { xpFriendlyName = 0, xpFriendlyNameAlt, 
-              xpServiceType, xpServiceTypeAlt, 
-              xpControlUrl, xpControlUrlAlt,
-              xpBrowseContainer, xpBrowseContainerAlt,
-              xpBrowseItem, xpBrowseItemAlt,
-              xpBrowseNumberReturned, xpBrowseNumberReturnedAlt,
-              xpSearchContainer, xpSearchContainerAlt,
-              xpSearchItem, xpSearchItemAlt,
-              xpSearchNumberReturned, xpSearchNumberReturnedAlt,
-              xpGetSearchCapabilities, xpGetSearchCapabilitiesAlt,
-              xpGetSortCapabilities, xpGetSortCapabilitiesAlt,
-              xpTitle, xpAlbum, xpArtist, xpGenre, xpClass, xpResource };
+              xpService, xpServiceAlt, 
+              xpBrowseContainer, xpBrowseItem, xpBrowseNumberReturned, xpBrowseTotalMatches, xpBrowseUpdateId,
+              xpSearchContainer, xpSearchItem, xpSearchNumberReturned, xpSearchTotalMatches, xpSearchUpdateId,
+              xpGetSearchCapabilities, xpGetSortCapabilities, xpGetSystemUpdateId,
+              xpEventSystemUpdateId, xpEventContainerUpdateIds };
+
+// results of MiniXPathSet when scanning event messages
+enum eXpathEvent { xeSystemUpdateId = 0, xeContainerUpdateIds };
+
+// results of MiniXPathSet when scanning browse/search replies
+enum eXpathSet { xsContainer = 0, xsItem, xsNumberReturned, xsTotalMatches, xsUpdateId };
 
 xPathParser_t xmlParserPaths[] = { 
   // for seeking servers
   { .sub = false, .num = 3, .tagNames = { "root", "device", "friendlyName" } },
   { .sub = true,  .num = 3, .tagNames = { "deviceList", "device", "friendlyName" } },
-  { .sub = false, .num = 5, .tagNames = { "root", "device", "serviceList", "service", "serviceType" } },
-  { .sub = true,  .num = 5, .tagNames = { "deviceList", "device", "serviceList", "service", "serviceType" } },
-  { .sub = false, .num = 5, .tagNames = { "root", "device", "serviceList", "service", "controlURL" } },
-  { .sub = true,  .num = 5, .tagNames = { "deviceList", "device", "serviceList", "service", "controlURL" } },
-  // for browsing servers
+  { .sub = false, .num = 4, .tagNames = { "root", "device", "serviceList", "service" } },
+  { .sub = true,  .num = 4, .tagNames = { "deviceList", "device", "serviceList", "service" } },
+  // for browsing servers (MiniXPathSet ignores namespace prefixes, e.g. "u:" also matches "m:")
   { .sub = true,  .num = 4, .tagNames = { "u:BrowseResponse", "Result", "DIDL-Lite", "container" } },
-  { .sub = true,  .num = 4, .tagNames = { "m:BrowseResponse", "Result", "DIDL-Lite", "container" } },
   { .sub = true,  .num = 4, .tagNames = { "u:BrowseResponse", "Result", "DIDL-Lite", "item" } },
-  { .sub = true,  .num = 4, .tagNames = { "m:BrowseResponse", "Result", "DIDL-Lite", "item" } },
   { .sub = true,  .num = 2, .tagNames = { "u:BrowseResponse", "NumberReturned" } },
-  { .sub = true,  .num = 2, .tagNames = { "m:BrowseResponse", "NumberReturned" } },
+  { .sub = true,  .num = 2, .tagNames = { "u:BrowseResponse", "TotalMatches" } },
+  { .sub = true,  .num = 2, .tagNames = { "u:BrowseResponse", "UpdateID" } },
   // for searching servers
   { .sub = true,  .num = 4, .tagNames = { "u:SearchResponse", "Result", "DIDL-Lite", "container" } },
-  { .sub = true,  .num = 4, .tagNames = { "m:SearchResponse", "Result", "DIDL-Lite", "container" } },
   { .sub = true,  .num = 4, .tagNames = { "u:SearchResponse", "Result", "DIDL-Lite", "item" } },
-  { .sub = true,  .num = 4, .tagNames = { "m:SearchResponse", "Result", "DIDL-Lite", "item" } },
   { .sub = true,  .num = 2, .tagNames = { "u:SearchResponse", "NumberReturned" } },
-  { .sub = true,  .num = 2, .tagNames = { "m:SearchResponse", "NumberReturned" } },
+  { .sub = true,  .num = 2, .tagNames = { "u:SearchResponse", "TotalMatches" } },
+  { .sub = true,  .num = 2, .tagNames = { "u:SearchResponse", "UpdateID" } },
   // for requesting search/sort capabilities
   { .sub = true,  .num = 2, .tagNames = { "u:GetSearchCapabilitiesResponse", "SearchCaps" } },
-  { .sub = true,  .num = 2, .tagNames = { "m:GetSearchCapabilitiesResponse", "SearchCaps" } },
   { .sub = true,  .num = 2, .tagNames = { "u:GetSortCapabilitiesResponse", "SortCaps" } },
-  { .sub = true,  .num = 2, .tagNames = { "m:GetSortCapabilitiesResponse", "SortCaps" } },
-  // for scanning items
-  { .sub = false, .num = 1, .tagNames = { "dc:title" } },
-  { .sub = false, .num = 1, .tagNames = { "upnp:album" } },
-  { .sub = false, .num = 1, .tagNames = { "upnp:artist" } },
-  { .sub = false, .num = 1, .tagNames = { "upnp:genre" } },
-  { .sub = false, .num = 1, .tagNames = { "upnp:class" } },
-  { .sub = false, .num = 1, .tagNames = { "res" } }
+  // for requesting system update id
+  { .sub = true,  .num = 2, .tagNames = { "u:GetSystemUpdateIDResponse", "Id" } },
+  // for scanning event messages (GENA NOTIFY)
+  { .sub = false, .num = 3, .tagNames = { "e:propertyset", "e:property", "SystemUpdateID" } },
+  { .sub = false, .num = 3, .tagNames = { "e:propertyset", "e:property", "ContainerUpdateIDs" } }
 };
 
+// for scanning containers & items, order must match eDidlAttr/eDidlElement
+const char *didlAttributes[] = { DIDL_ATTR_ID, DIDL_ATTR_PARENT_ID, DIDL_ATTR_CHILD_COUNT, DIDL_ATTR_SEARCHABLE,
+                                 DIDL_ATTR_SIZE, DIDL_ATTR_BITRATE, DIDL_ATTR_SAMPLEFREQU, DIDL_ATTR_PROT_INFO };
+const char *didlElements[] = { "dc:title", "upnp:album", "upnp:artist", "upnp:genre", "upnp:class", "res" };
+
 const char *fileTypes[] = { "other", "audio", "picture", "video", "" };
 
+// request templates, order must match eSoapRequest. Slot markers get replaced when serializing
+#define SOAP_POST_HEADER(action) "POST /" SOAP_SLOT_URI " " HTTP_VERSION "\r\n" HEADER_HOST SOAP_SLOT_HOST "\r\n" \
+                                 "CACHE-CONTROL: no-cache\r\nPRAGMA: no-cache\r\n" SOAP_SLOT_CONNECTION \
+                                 HEADER_CONTENT_LENGTH SOAP_SLOT_LENGTH "\r\n" HEADER_CONTENT_TYPE action \
+                                 HEADER_USER_AGENT HEADER_EMPTY_LINE
+#define SOAP_BROWSE_BODY(flag)   SOAP_ENVELOPE_START SOAP_BODY_START SOAP_BROWSE_START \
+                                 SOAP_OBJECTID_START SOAP_SLOT_OBJECTID SOAP_OBJECTID_END \
+                                 SOAP_BROWSEFLAG_START flag SOAP_BROWSEFLAG_END \
+                                 SOAP_FILTER_START SOAP_DEFAULT_BROWSE_FILTER SOAP_FILTER_END \
+                                 SOAP_STARTINGINDEX_START SOAP_SLOT_INDEX SOAP_STARTINGINDEX_END \
+                                 SOAP_REQUESTEDCOUNT_START SOAP_SLOT_COUNT SOAP_REQUESTEDCOUNT_END \
+                                 SOAP_SORTCRITERIA_START SOAP_DEFAULT_BROWSE_SORT_CRITERIA SOAP_SORTCRITERIA_END \
+                                 SOAP_BROWSE_END SOAP_BODY_END SOAP_ENVELOPE_END
+
+#define GENA_HEADER(method)      method " /" SOAP_SLOT_URI " " HTTP_VERSION "\r\n" HEADER_HOST SOAP_SLOT_HOST "\r\n"
+#define GENA_HEADER_END          HEADER_CONNECTION_CLOSE HEADER_USER_AGENT HEADER_EMPTY_LINE
+
+const char *requestMethods[] = { "GET", "POST", "POST", "POST", "POST", "POST", "HEAD", "POST", 
+                                 "SUBSCRIBE", "SUBSCRIBE", "UNSUBSCRIBE" };
+
+const char *requestHeaders[] = {
+  "GET /" SOAP_SLOT_URI " " HTTP_VERSION "\r\n" HEADER_HOST SOAP_SLOT_HOST "\r\n" SOAP_SLOT_RANGE
+    HEADER_CONNECTION_CLOSE HEADER_USER_AGENT HEADER_EMPTY_LINE,
+  SOAP_POST_HEADER(HEADER_SOAP_ACTION_BROWSE),
+  SOAP_POST_HEADER(HEADER_SOAP_ACTION_BROWSE),
+  SOAP_POST_HEADER(HEADER_SOAP_ACTION_SEARCH),
+  SOAP_POST_HEADER(HEADER_SOAP_ACTION_GETSEARCHCAP),
+  SOAP_POST_HEADER(HEADER_SOAP_ACTION_GETSORTCAP),
+  "HEAD /" SOAP_SLOT_URI " " HTTP_VERSION "\r\n" HEADER_HOST SOAP_SLOT_HOST "\r\n" 
+    HEADER_CONNECTION_CLOSE HEADER_USER_AGENT HEADER_EMPTY_LINE,
+  SOAP_POST_HEADER(HEADER_SOAP_ACTION_GETSYSUPDID),
+  GENA_HEADER("SUBSCRIBE") "CALLBACK: <" SOAP_SLOT_CALLBACK ">\r\nNT: upnp:event\r\n" 
+    HEADER_TIMEOUT " " HEADER_TIMEOUT_SECOND SOAP_SLOT_TIMEOUT "\r\n" GENA_HEADER_END,
+  GENA_HEADER("SUBSCRIBE") HEADER_SID " " SOAP_SLOT_SID "\r\n" 
+    HEADER_TIMEOUT " " HEADER_TIMEOUT_SECOND SOAP_SLOT_TIMEOUT "\r\n" GENA_HEADER_END,
+  GENA_HEADER("UNSUBSCRIBE") HEADER_SID " " SOAP_SLOT_SID "\r\n" GENA_HEADER_END
+};
+
+const char *requestBodies[] = {
+  "",
+  SOAP_BROWSE_BODY(SOAP_DEFAULT_BROWSE_FLAG),
+  SOAP_BROWSE_BODY(SOAP_BROWSE_FLAG_METADATA),
+  SOAP_ENVELOPE_START SOAP_BODY_START SOAP_SEARCH_START 
+    SOAP_CONTAINERID_START SOAP_SLOT_OBJECTID SOAP_CONTAINERID_END 
+    SOAP_SEARCHCRITERIA_START SOAP_SLOT_CRITERIA SOAP_SEARCHCRITERIA_END 
+    SOAP_FILTER_START SOAP_DEFAULT_SEARCH_FILTER SOAP_FILTER_END 
+    SOAP_STARTINGINDEX_START SOAP_SLOT_INDEX SOAP_STARTINGINDEX_END 
+    SOAP_REQUESTEDCOUNT_START SOAP_SLOT_COUNT SOAP_REQUESTEDCOUNT_END 
+    SOAP_SORTCRITERIA_START SOAP_SLOT_SORT SOAP_SORTCRITERIA_END 
+    SOAP_SEARCH_END SOAP_BODY_END SOAP_ENVELOPE_END,
+  SOAP_ENVELOPE_START SOAP_BODY_START SOAP_GETSEARCHCAP_START SOAP_GETSEARCHCAP_END SOAP_BODY_END SOAP_ENVELOPE_END,
+  SOAP_ENVELOPE_START SOAP_BODY_START SOAP_GETSORTCAP_START SOAP_GETSORTCAP_END SOAP_BODY_END SOAP_ENVELOPE_END,
+  "",
+  SOAP_ENVELOPE_START SOAP_BODY_START SOAP_GETSYSUPDID_START SOAP_GETSYSUPDID_END SOAP_BODY_END SOAP_ENVELOPE_END,
+  "",
+  "",
+  ""
+};
+
+// results of soapReplyParse()
+enum eSoapReply { replyBusy = 0, replyDone, replyStopped };
+
+// evaluation of a browse/search reply, can be resumed whenever new data arrives
+struct soapReply_t
+{
+  String objId;                   // container browsed/searched
+  bool search;
+  bool chunked;
+  bool gotCount;                  // NumberReturned found
+  bool reusable;                  // connection can be kept open after reply
+  int count, countContainer, countItem;
+  soapPageInfo_t info;
+  soapObjectVect_t *result;
+  soapObjectVect_t single;        // holds only the latest object when a callback is used
+  soapObjectCallback_t callback;
+  void *arg;
+  MiniXPathSet xPathSet;
+  String str;
+  String strAttribute;
+  char xml[SOAP_XML_BLOCK_SIZE];  // block of reply read ahead, not parsed yet from xmlHead on
+  uint16_t xmlHead, xmlTail;
+};
+
+// states of an asynchronous request
+enum eAsyncState { asyncSend = 0, asyncConnect, asyncWaitReply, asyncHeader, asyncBody };
+
+// asynchronous request, driven by poll()
+struct soapAsync_t
+{
+  eAsyncState state;
+  bool download;                  // false: browse/search
+  bool subscribe;                 // SUBSCRIBE sent by soapEventPoll(), nobody waits for it
+  bool search;                    // false: browse
+  bool retried;                   // request already sent again on a new connection
+  uint32_t start;                 // millis() when request was sent (or connection attempt started)
+  uint8_t attempts;               // connection attempts made by soapAsyncConnect()
+  bool connected;                 // connection opened by soapAsyncConnect(), not a kept-alive one
+#ifndef USE_ETHERNET
+  int fd;                         // socket being connected by soapAsyncConnect(), -1 if none
+#endif
+  // request
+  unsigned int srv;
+  IPAddress ip;
+  uint16_t port;
+  String uri;                     // control url or file uri
+  String objectId;
+  String searchCriteria;          // empty: browse
+  String sortCriteria;
+  uint32_t startingIndex;
+  uint16_t maxCount;
+  uint64_t objectSize;            // download: size given by media object
+  String sid;                     // subscribe: subscription id to renew, empty for a new subscription
+  uint32_t timeout;               // subscribe: s, requested duration
+  // callbacks
+  soapDoneCallback_t done;
+  soapReadyCallback_t ready;
+  void *arg;
+  // HTTP header
+  char line[TMP_BUFFER_SIZE_200];
+  size_t lineLength;
+  bool firstLine;
+  bool headerOk;
+  uint64_t contentLength;
+  bool chunked;
+  String replySid;                // subscribe: subscription id & duration granted by server
+  uint32_t granted;
+  // browse/search reply
+  soapReply_t reply;
+};
+
+// cached browse/search result, see setCache()
+struct soapCacheEntry_t
+{
+  uint32_t hash;                  // over request parameters, speeds up lookup
+  IPAddress ip;                   // server
+  uint16_t port;
+  bool search;                    // false: browse
+  String objectId;
+  String searchCriteria;
+  String sortCriteria;
+  uint32_t startingIndex;
+  uint16_t maxCount;
+  soapPageInfo_t page;            // counters reported with result
+  SoapResultSet result;           // objects, compact & without spare memory
+  uint32_t lastUsed;              // cache tick of last hit
+  size_t memory;                  // bytes held by this entry
+
+  soapCacheEntry_t() : result(0, 0) {}
+};
+
+// collects objects of a browse/search reply for the cache while handing them over as requested
+struct soapCacheFill_t
+{
+  SoapResultSet *set;
+  soapObjectVect_t *result;       // either result list
+  soapObjectCallback_t callback;  // or callback of caller
+  void *arg;
+};
+
+// read-ahead buffer of downloads, see setReadAhead(). Single producer (task reading from server) & 
+// single consumer (read()), the fill level is the only value both of them change
+struct soapReadAhead_t
+{
+  uint8_t *buffer;
+  size_t size;
+  size_t low;                     // task resumes reading when fill level has dropped to this
+  size_t high;                    // task pauses reading when fill level has reached this
+  size_t head;                    // next byte written, task only
+  size_t tail;                    // next byte read, read() only
+  std::atomic<size_t> fill;
+  uint64_t left;                  // bytes not yet delivered by read()
+  TaskHandle_t task;              // NULL if no download is read ahead
+  volatile bool stop;             // task has to finish
+  volatile bool paused;           // task waits for fill level to drop to low watermark
+  volatile bool done;             // task finished, no more data gets added
+  volatile int result;            // set by task when done: 0 if all data received, read() error otherwise
+  soapReadAheadStats_t stats;
+};
+
+// states of a task fetching segments, see downloadSegmented()
+enum eSegmentState { segFetching = 0, segReady, segFailed };
+
+// task fetching every n-th segment of a segmented download into its buffer
+struct soapSegmentWorker_t
+{
+  soapSegmentJob_t *job;
+  uint8_t *buffer;                // holds one segment
+  volatile uint32_t segment;      // segment being fetched or in buffer
+  volatile size_t length;         // bytes of segment in buffer
+  volatile eSegmentState state;   // segReady: caller owns buffer until it sets segFetching again
+};
+
+// segmented download, shared by caller & tasks
+struct soapSegmentJob_t
+{
+  soapObject_t object;            // file to download
+#ifdef USE_ETHERNET
+  SemaphoreHandle_t *sem;         // SPI semaphore of calling SoapESP32 object
+#endif
+  uint64_t total;                 // file size
+  size_t segmentSize;
+  uint32_t segments;              // number of segments
+  unsigned int workers;           // number of tasks
+  soapSegmentWorker_t *worker;
+  volatile bool stop;             // caller finished or gave up, tasks have to finish
+  std::atomic<int> refs;          // job gets deleted by the last one of caller & tasks releasing it
+};
+
+// states of an event message being received
+enum eEventRxState { eventRequestLine = 0, eventHeader, eventBody };
+
+// event message being received by poll() as data comes in, client gets read in blocks
+struct soapEventRx_t
+{
+#ifdef USE_ETHERNET
+  EthernetClient client;
+#else
+  WiFiClient client;
+#endif
+  eEventRxState state;
+  uint32_t start;                 // millis() when message arrived
+  size_t head;                    // next byte to deliver from buffer
+  size_t tail;                    // end of valid data in buffer
+  uint8_t buffer[TMP_BUFFER_SIZE_200];
+  char line[TMP_BUFFER_SIZE_200]; // header line being assembled
+  size_t lineLength;
+  String sid;
+  uint32_t seq;
+  uint64_t contentLength;         // bytes of body not received yet
+  MiniXPathSet xPathEvent;
+  String str;
+  soapEvent_t event;
+};
+
 //
 // helper function, find the first occurrence of substring "what" in string "s", ignore case
 //
@@ -113,17 +379,93 @@ char *strcasestr(const char *s, const char *what)
 }
 #endif
 
+//
+// helper function, callback storing objects in a SoapResultSet
+//
+static bool soapResultSetAdd(const soapObject_t *object, void *arg)
+{
+  return ((SoapResultSet *)arg)->add(object);
+}
+
+//
+// helper function, callback storing objects for the cache and passing them on to caller
+//
+static bool soapCacheAdd(const soapObject_t *object, void *arg)
+{
+  soapCacheFill_t *fill = (soapCacheFill_t *)arg;
+
+  // a set reaching the cache size stops growing & just doesn't get cached
+  if (!fill->set->full()) fill->set->add(object);
+  if (fill->callback) return fill->callback(object, fill->arg);
+  fill->result->push_back(*object);
+
+  return true;
+}
+
+//
+// helper function, FNV-1a hash over browse/search request parameters
+//
+static uint32_t soapCacheHash(const char *objectId, const char *searchCriteria, const char *sortCriteria,
+                              const uint32_t startingIndex, const uint16_t maxCount)
+{
+  const char *str[] = { objectId, searchCriteria ? searchCriteria : "", sortCriteria ? sortCriteria : "" };
+  uint32_t hash = 2166136261u;
+
+  for (int i = 0; i < 3; i++) {
+    for (const char *p = str[i]; *p; p++) hash = (hash ^ (uint8_t)*p) * 16777619u;
+    hash = (hash ^ 0xff) * 16777619u;     // separator, so "ab"+"c" differs from "a"+"bc"
+  }
+  hash = (hash ^ startingIndex) * 16777619u;
+  hash = (hash ^ maxCount) * 16777619u;
+  hash ^= (searchCriteria != NULL);
+
+  return hash;
+}
+
 //
 // SoapESP32 Class Constructor
 //
 #ifdef USE_ETHERNET
 SoapESP32::SoapESP32(EthernetClient *client, EthernetUDP *udp, SemaphoreHandle_t *sem)
-  : m_client(client), m_udp(udp), m_SPIsem(sem), m_clientDataConOpen(false), m_clientDataAvailable(0)
+  : m_client(client), m_udp(udp), m_SPIsem(sem), m_clientDataConOpen(false), m_clientDataAvailable(0), 
+    m_rxHead(0), m_rxTail(0), m_txFill(0), m_prefetchPending(false), m_prefetchTag(0), 
+    m_keepAlive(true), m_conIdle(false), m_conClose(false), m_conPort(0), m_bodyRemaining(0), m_chunkEnd(false),
+    m_chunkState(chunkSize), m_chunkDigits(0), m_conReused(false), m_rxLast(0), m_async(NULL), m_seek(NULL),
+    m_deadline(0), m_seekParallel(SSDP_DESCRIPTION_PARALLEL),
+    m_cacheMax(0), m_cacheTick(0), m_cacheStats(), m_eventServer(NULL), m_eventPort(0), 
+    m_eventCallback(NULL), m_eventArg(NULL), m_eventRx(NULL), m_readAhead(NULL), m_httpStatus(0), 
+    m_rangeRequest(false), m_contentRange(), m_SPIStats(), m_SPIClaimed(0), m_yieldPolicy(yieldWallClock), 
+    m_yieldInterval(SOAP_YIELD_DEFAULT_INTERVAL), m_yieldBytes(0), m_yieldLast(0)
 #else
 SoapESP32::SoapESP32(WiFiClient *client, WiFiUDP *udp)
-  : m_client(client), m_udp(udp), m_clientDataConOpen(false), m_clientDataAvailable(0)
+  : m_client(client), m_udp(udp), m_clientDataConOpen(false), m_clientDataAvailable(0), 
+    m_rxHead(0), m_rxTail(0), m_txFill(0), m_prefetchPending(false), m_prefetchTag(0), 
+    m_keepAlive(true), m_conIdle(false), m_conClose(false), m_conPort(0), m_bodyRemaining(0), m_chunkEnd(false),
+    m_chunkState(chunkSize), m_chunkDigits(0), m_conReused(false), m_rxLast(0), m_async(NULL), m_seek(NULL),
+    m_deadline(0), m_seekParallel(SSDP_DESCRIPTION_PARALLEL),
+    m_cacheMax(0), m_cacheTick(0), m_cacheStats(), m_eventServer(NULL), m_eventPort(0), 
+    m_eventCallback(NULL), m_eventArg(NULL), m_eventRx(NULL), m_readAhead(NULL), m_httpStatus(0), 
+    m_rangeRequest(false), m_contentRange(), m_SPIStats(), m_SPIClaimed(0), m_yieldPolicy(yieldWallClock), 
+    m_yieldInterval(SOAP_YIELD_DEFAULT_INTERVAL), m_yieldBytes(0), m_yieldLast(0)
+#endif
+{
+#ifdef SOAP_REQUEST_STATS
+  m_reqStats = m_reqStatsLast = soapRequestStats_t();
+  m_reqStart = m_reqScanStart = m_reqHeap = 0;
+  m_reqOpen = false;
 #endif
+}
+
+SoapESP32::~SoapESP32()
 {
+  soapCancelSeek();
+  soapCancelAsync(true);
+  soapCancelAsync(false);           // started by callback of the one before
+  soapEventDrop();
+  soapUnsubscribeAll();
+  clearCache();
+  soapReadAheadStop();
+  setReadAhead(0);
 }
 
 //
@@ -182,32 +524,245 @@ bool SoapESP32::wakeUpServer(const char *macAddress)
 }
 
 //
-// helper function, client timed read
+// helper function, refill receive buffer with as many bytes as the client can deliver
+//  - only called when receive buffer is empty
+//  - returns false in case of read timeout
 //
-int SoapESP32::soapClientTimedRead(unsigned long ms)
+bool SoapESP32::soapClientFill(unsigned long ms)
 {
-  int c;
-  unsigned long timeout = ms ? ms : SERVER_READ_TIMEOUT,
+  int len;
+  unsigned long timeout = soapTimeLeft(ms ? ms : SERVER_READ_TIMEOUT),
                 startMillis = millis();
 
   do {
     claimSPI();
-    c = m_client->read();
+    len = m_client->read(m_rxBuffer, sizeof(m_rxBuffer));
     releaseSPI();
-    if (c >= 0) {
-      return c;
+    if (len > 0) {
+      statsReceived(len);
+      m_rxHead = 0;
+      m_rxTail = len;
+      m_rxLast = millis();
+      return true;
     }
+    idleSPI();
   } 
   while (millis() - startMillis < timeout);
 
-  return -1;     // read timeout
+  return false;    // read timeout
+}
+
+//
+// helper function, limit a timeout to the time left until the deadline of the current request (if any)
+//
+unsigned long SoapESP32::soapTimeLeft(unsigned long ms)
+{
+  if (m_deadline) {
+    int32_t left = (int32_t)(m_deadline - millis());
+    if (left <= 0) return 0;
+    if ((unsigned long)left < ms) return left;
+  }
+
+  return ms;
+}
+
+//
+// helper function, client timed read (served from receive buffer)
+//
+int SoapESP32::soapClientTimedRead(unsigned long ms)
+{
+  if (m_rxHead >= m_rxTail && !soapClientFill(ms)) {
+    return -1;     // read timeout
+  }
+
+  return m_rxBuffer[m_rxHead++];
+}
+
+//
+// helper function, next byte from receive buffer. Without wait the receive buffer gets refilled 
+// only with data already received, returns SOAP_WOULD_BLOCK if there is none yet and -1 if the 
+// connection is closed
+//
+int SoapESP32::soapClientReadByte(bool wait)
+{
+  if (m_rxHead >= m_rxTail) {
+    int res = soapClientRefill(wait);
+    if (res < 0) return res;
+  }
+
+  return m_rxBuffer[m_rxHead++];
+}
+
+//
+// helper function, refill empty receive buffer. Without wait only with data already received, 
+// returns SOAP_WOULD_BLOCK if there is none yet. Returns -1 in case of read timeout or if the 
+// connection is closed, number of bytes received otherwise
+//
+int SoapESP32::soapClientRefill(bool wait)
+{
+  if (wait) return soapClientFill() ? m_rxTail : -1;
+
+  claimSPI();
+  int len = m_client->read(m_rxBuffer, sizeof(m_rxBuffer));
+  bool con = (len > 0) || m_client->connected();
+  releaseSPI();
+  if (len <= 0) return con ? SOAP_WOULD_BLOCK : -1;
+  statsReceived(len);
+  m_rxHead = 0;
+  m_rxTail = len;
+  m_rxLast = millis();
+
+  return len;
+}
+
+//
+// helper function, incremental de-chunking of a reply body (XML data & downloads), works on whole 
+// blocks in the receive buffer: chunk framing found there (chunk size line incl. extensions, "\r\n" 
+// trailing chunk data, trailer lines following final chunk) gets consumed. Returns the number of 
+// bytes of chunk data available at m_rxHead, the caller passes them on with soapChunkConsume().
+// The receive buffer gets refilled when needed (without wait only with data already received).
+// Returns SOAP_WOULD_BLOCK, -1 (read timeout, connection closed), -2/-3 (bad chunk size) or -4 
+// (final chunk & trailer read, m_chunkEnd set)
+//
+int SoapESP32::soapChunkData(bool wait)
+{
+  while (!m_chunkEnd) {
+    if (m_rxHead >= m_rxTail) {
+      int res = soapClientRefill(wait);
+      if (res < 0) return res;
+    }
+    if (m_chunkState == chunkData) {
+      size_t n = m_rxTail - m_rxHead;
+      return (n < (size_t)m_ChunkCount) ? n : m_ChunkCount;
+    }
+    while (m_rxHead < m_rxTail && m_chunkState != chunkData) {
+      int c = m_rxBuffer[m_rxHead++];
+
+      switch (m_chunkState) {
+        case chunkDataEnd:
+          if (c == '\n') {
+            m_chunkState = chunkSize;
+            m_ChunkCount = 0;
+            m_chunkDigits = 0;
+          }
+          break;
+        case chunkSize:
+          if (isxdigit(c)) {
+            if (m_ChunkCount >= 0x8000000) return -3;
+            m_ChunkCount = (m_ChunkCount << 4) + (isdigit(c) ? c - '0' : tolower(c) - 'a' + 10);
+            if (m_chunkDigits < UINT8_MAX) m_chunkDigits++;
+            break;
+          }
+          m_chunkState = chunkSizeEnd;  // chunk extensions (";name=value") or "\r\n" follow
+          // fall through
+        case chunkSizeEnd:
+          if (c != '\n') break;
+          if (!m_chunkDigits) return -2;   // we expect at least 1 digit chunk size
+          log_d("announced chunk size: 0x%x(%d)", m_ChunkCount, m_ChunkCount);
+          statsAdd(chunks, 1);
+          m_chunkDigits = 0;
+          // final chunk size is 0, optional trailer lines follow
+          m_chunkState = (m_ChunkCount > 0) ? chunkData : chunkTrailer;
+          break;
+        case chunkTrailer:
+          // trailer fields are ignored, empty line ends reply
+          if (c == '\n') {
+            if (!m_chunkDigits) {
+              m_chunkEnd = true;
+              return -4;
+            }
+            m_chunkDigits = 0;
+          }
+          else if (c != '\r' && m_chunkDigits < UINT8_MAX) {
+            m_chunkDigits++;
+          }
+          break;
+        default:
+          break;
+      }
+    }
+  }
+
+  return -4;
+}
+
+//
+// helper function, size bytes of chunk data have been passed on
+//
+void SoapESP32::soapChunkConsume(size_t size)
+{
+  m_ChunkCount -= size;
+  if (m_ChunkCount <= 0) m_chunkState = chunkDataEnd;
+}
+
+//
+// helper function, read up to size bytes: data left in receive buffer first, then straight from client
+//
+int SoapESP32::soapClientRead(uint8_t *buf, size_t size)
+{
+  int res;
+
+  if (m_rxHead < m_rxTail) {
+    res = (size < m_rxTail - m_rxHead) ? size : m_rxTail - m_rxHead;
+    memcpy(buf, m_rxBuffer + m_rxHead, res);
+    m_rxHead += res;
+  }
+  else {
+    claimSPI();
+    res = m_client->read(buf, size);
+    releaseSPI();
+    if (res > 0) statsReceived(res);
+  }
+
+  return res;
+}
+
+//
+// helper function, like soapClientRead() but without copying: data points to up to size bytes in 
+// the receive buffer, which gets refilled from client if empty
+//
+int SoapESP32::soapClientSpan(const uint8_t **data, size_t size)
+{
+  if (m_rxHead >= m_rxTail) {
+    claimSPI();
+    int len = m_client->read(m_rxBuffer, sizeof(m_rxBuffer));
+    releaseSPI();
+    if (len <= 0) return len;
+    statsReceived(len);
+    m_rxHead = 0;
+    m_rxTail = len;
+    m_rxLast = millis();
+  }
+  if (size > m_rxTail - m_rxHead) size = m_rxTail - m_rxHead;
+  *data = m_rxBuffer + m_rxHead;
+  m_rxHead += size;
+
+  return size;
+}
+
+//
+// helper function, read a line into buf (same as Stream::readBytesUntil('\n',...) but served from receive buffer)
+//  - returns number of characters placed in buf, terminating '\n' is not included
+//
+size_t SoapESP32::soapClientReadLine(char *buf, size_t length, unsigned long ms)
+{
+  size_t len = 0;
+
+  while (len < length) {
+    int c = soapClientTimedRead(ms);
+    if (c < 0 || c == '\n') break;
+    buf[len++] = (char)c;
+  }
+
+  return len;
 }
 
 //
 // send SSDP/UDP multicast M-SEARCH packets
-// - parameter is how often a M-SEARCH packet is to be repeated
+// - parameter repeats is how often a M-SEARCH packet is to be repeated
+// - parameter mx is the max. delay in seconds servers may wait before replying
 //
-bool SoapESP32::soapUDPmulticast(unsigned int repeats)
+bool SoapESP32::soapUDPmulticast(unsigned int repeats, unsigned int mx)
 {
   if (!m_udp) return false;
 
@@ -223,8 +778,8 @@ bool SoapESP32::soapUDPmulticast(unsigned int repeats)
     unsigned int i = 0;
     String strMS(SSDP_M_SEARCH), strCD(SSDP_M_SEARCH);
 
-    strMS += SSDP_DEVICE_TYPE_MS; strMS += "\r\n\r\n";
-    strCD += SSDP_SERVICE_TYPE_CD; strCD += "\r\n\r\n";
+    strMS += mx; strMS += "\r\nST: "; strMS += SSDP_DEVICE_TYPE_MS; strMS += "\r\n\r\n";
+    strCD += mx; strCD += "\r\nST: "; strCD += SSDP_SERVICE_TYPE_CD; strCD += "\r\n\r\n";
 
     // send M-SEARCH packets with device type MediaServer & service type ContentDirectory
     while (true) {
@@ -266,86 +821,114 @@ bool SoapESP32::soapUDPmulticast(unsigned int repeats)
 }
 
 //
-// SSDP/UDP search for media servers in local network
+// evaluate next incoming SSDP packet (M-SEARCH reply or NOTIFY packet if we catch it by chance)
+//  - parameter start is millis() when search was started (for logging)
+//  - returns ssdpNewServer if a new server got added to result list
 //
-bool SoapESP32::soapSSDPquery(soapServerVect_t *result, int msWait)
+int SoapESP32::soapSSDPreceive(soapServerVect_t *result, uint32_t start)
 {
-  int port;
+  int port, ret = ssdpIgnored;
   unsigned int i;
   size_t len;
   IPAddress ip;
   char location[SSDP_LOCATION_BUF_SIZE] = "",
-       address[20];
+       address[20],
+       udn[64] = "";
 
-  // send SSDP multicast packets (parameter: nr of repeats)
-  if (!soapUDPmulticast(SSDP_M_SEARCH_REPEATS)) return false;
+  claimSPI();
+  len = m_udp->parsePacket();
+  releaseSPI();
+  if (!len) return ssdpNone;
 
-  // evaluate incoming SSDP packets (M-SEARCH replies) & NOTIFY packets if we catch them by chance
-  uint32_t start = millis();
-  do
-  {
-    delay(1);
-    claimSPI();
-    len = m_udp->parsePacket();
+  char *p, *buffer;
+  
+  // SSDP packet of size len received
+  buffer = (char *)calloc(len + 1, sizeof(byte)); // allocate and set memory to 0
+  if (!buffer) {
+    claimSPI();  
+    m_udp->stop();
     releaseSPI();
-    if (len) {
-      char *p, *buffer;
-      
-      // SSDP packet of size len received
-      buffer = (char *)calloc(len + 1, sizeof(byte)); // allocate and set memory to 0
-      if (!buffer) {
-        claimSPI();  
-        m_udp->stop();
-        releaseSPI();
-        log_e("calloc() couldn't allocate memory");    
-        return false;
-      }      
-      claimSPI();
-      m_udp->read(buffer, len);                       // read packet into the buffer
-      releaseSPI();
-      log_d("SSDP (%s) within %d ms, size %d", strstr(buffer, HTTP_HEADER_200_OK) ? "REPLY" : "NOTIFY", millis() - start, len);
+    log_e("calloc() couldn't allocate memory");    
+    return ssdpError;
+  }      
+  claimSPI();
+  m_udp->read(buffer, len);                       // read packet into the buffer
+  releaseSPI();
+  log_d("SSDP (%s) within %d ms, size %d", strstr(buffer, HTTP_HEADER_200_OK) ? "REPLY" : "NOTIFY", millis() - start, len);
 #if CORE_DEBUG_LEVEL == 5
-      log_v("packet content:\n%s", buffer);
-      delay(1);
+  log_v("packet content:\n%s", buffer);
+  delay(1);
 #endif
 
-      // scan SSDP packet
-      if ( // M-SEARCH reply packets
-           (strstr(buffer, HTTP_HEADER_200_OK) &&
-            ((p = strcasestr(buffer, SSDP_LOCATION)) != NULL) && 
-             (strcasestr(buffer, SSDP_DEVICE_TYPE_MS) || strcasestr(buffer, SSDP_SERVICE_TYPE_CD))
-           ) ||
-           // NOTIFY packets sent out regularly by media servers (we ignore ssdp:byebye's)
-           (strstr(buffer, SSDP_NOTIFICATION) && strcasestr(buffer, SSDP_NOTIFICATION_SUB_TYPE) &&
-            ((p = strcasestr(buffer, SSDP_LOCATION)) != NULL) && 
-            (strcasestr(buffer, SSDP_DEVICE_TYPE_MS) || strcasestr(buffer, SSDP_SERVICE_TYPE_CD))
-           )
-         ) {  
-        char format[30];
-
-        strtok(p, "\r\n");
-        snprintf(format, sizeof(format), "http://%%[0-9.]:%%d/%%%ds", SSDP_LOCATION_BUF_SIZE - 1);
-        if (sscanf(p + 10, format, address, &port, location) < 2) goto CONT;
-        if (!ip.fromString(address)) goto CONT;
-
-        // scanning of ip & port successful, location string can be missing (e.g. D-Link NAS DNS-320L)
-        log_d("scanned ip=%s, port=%d, loc=\"%s\"",  ip.toString().c_str(), port, location);
-        if (!strlen(location)) log_d("empty location string!");
-
-        // avoid multiple entries of same server (identical ip & port)
-        for (i = 0; i < result->size(); i++) {
-          if (result->operator[](i).ip == ip && result->operator[](i).port == port) break;               
+  // scan SSDP packet
+  if ( // M-SEARCH reply packets
+       (strstr(buffer, HTTP_HEADER_200_OK) &&
+        ((p = strcasestr(buffer, SSDP_LOCATION)) != NULL) && 
+         (strcasestr(buffer, SSDP_DEVICE_TYPE_MS) || strcasestr(buffer, SSDP_SERVICE_TYPE_CD))
+       ) ||
+       // NOTIFY packets sent out regularly by media servers (we ignore ssdp:byebye's)
+       (strstr(buffer, SSDP_NOTIFICATION) && strcasestr(buffer, SSDP_NOTIFICATION_SUB_TYPE) &&
+        ((p = strcasestr(buffer, SSDP_LOCATION)) != NULL) && 
+        (strcasestr(buffer, SSDP_DEVICE_TYPE_MS) || strcasestr(buffer, SSDP_SERVICE_TYPE_CD))
+       )
+     ) {  
+    char format[30], *u;
+
+    // unique device name: "USN: uuid:<device-UUID>::<type>", needs to be scanned before location gets cut
+    if ((u = strcasestr(buffer, SSDP_USN)) != NULL) {
+      u += strlen(SSDP_USN);
+      while (*u == ' ') u++;
+      if (!strncasecmp(u, SSDP_UUID, strlen(SSDP_UUID))) {
+        for (i = 0; i < sizeof(udn) - 1 && u[i] && u[i] != '\r' && u[i] != '\n' && strncmp(u + i, "::", 2); i++) {
+          udn[i] = u[i];
         }
-        if (i < result->size()) goto CONT;
-
-        // new server found: add to list
-        soapServer_t srv = {.ip = ip, .port = (uint16_t)port, .location = location, .friendlyName = "", .controlURL = "" };
-        result->push_back(srv);
-        log_i("server added to list ip=%s, port=%d, loc=\"%s\"", ip.toString().c_str(), port, location);
+        udn[i] = 0;
       }
-CONT:
-      free(buffer);
     }
+
+    strtok(p, "\r\n");
+    snprintf(format, sizeof(format), "http://%%[0-9.]:%%d/%%%ds", SSDP_LOCATION_BUF_SIZE - 1);
+    if (sscanf(p + 10, format, address, &port, location) < 2) goto CONT;
+    if (!ip.fromString(address)) goto CONT;
+
+    // scanning of ip & port successful, location string can be missing (e.g. D-Link NAS DNS-320L)
+    log_d("scanned ip=%s, port=%d, loc=\"%s\", udn=\"%s\"",  ip.toString().c_str(), port, location, udn);
+    if (!strlen(location)) log_d("empty location string!");
+
+    // avoid multiple entries of same server (identical ip & port)
+    for (i = 0; i < result->size(); i++) {
+      if (result->operator[](i).ip == ip && result->operator[](i).port == port) break;               
+    }
+    if (i < result->size()) goto CONT;
+
+    // new server found: add to list
+    soapServer_t srv = {.ip = ip, .port = (uint16_t)port, .location = location, .friendlyName = "", .controlURL = "", .eventURL = "", 
+                        .udn = udn };
+    result->push_back(srv);
+    log_i("server added to list ip=%s, port=%d, loc=\"%s\"", ip.toString().c_str(), port, location);
+    ret = ssdpNewServer;
+  }
+CONT:
+  free(buffer);
+
+  return ret;
+}
+
+//
+// SSDP/UDP search for media servers in local network
+//
+bool SoapESP32::soapSSDPquery(soapServerVect_t *result, int msWait)
+{
+  // send SSDP multicast packets (parameter: nr of repeats)
+  if (!soapUDPmulticast(SSDP_M_SEARCH_REPEATS)) return false;
+
+  // evaluate incoming SSDP packets (M-SEARCH replies) & NOTIFY packets if we catch them by chance
+  uint32_t start = millis();
+  do
+  {
+    int ret = soapSSDPreceive(result, start);
+    if (ret == ssdpError) return false;
+    if (ret == ssdpNone) delay(1);
   }
   while ((millis() - start) < msWait);
 
@@ -365,166 +948,280 @@ bool SoapESP32::soapReadHttpHeader(uint64_t *contentLength, bool *chunked)
 {
   size_t len;
   bool ok = false;
-  char *p, tmpBuffer[TMP_BUFFER_SIZE_200];
+  char tmpBuffer[TMP_BUFFER_SIZE_200];
+
+  // new reply, nothing buffered yet
+  m_rxHead = m_rxTail = 0;
+  m_conClose = false;
 
   // first line contains status code
-  claimSPI();
-  len = m_client->readBytesUntil('\n', tmpBuffer, sizeof(tmpBuffer) - 1);   // length without terminator '\n'
-  releaseSPI();
-  tmpBuffer[len] = 0;
-  if (!strstr(tmpBuffer, HTTP_HEADER_200_OK)) {
-    log_i("header line: %s", tmpBuffer);
-    return false;
+  len = soapClientReadLine(tmpBuffer, sizeof(tmpBuffer) - 1);   // length without terminator '\n'
+  if (soapHttpHeaderLine(tmpBuffer, len, true, contentLength, chunked, &ok) < 0) return false;
+  while (true) {
+    if (m_rxHead >= m_rxTail) {
+      claimSPI();
+      int av = m_client->available();
+      releaseSPI();
+      if (!av) break;
+    }
+    len = soapClientReadLine(tmpBuffer, sizeof(tmpBuffer) - 1);
+    if (soapHttpHeaderLine(tmpBuffer, len, false, contentLength, chunked, &ok) == 0) break;
   }
-  else {
+  soapHttpHeaderEnd(ok, *contentLength, chunked);
+
+  return ok;
+}
+
+//
+// helper function, evaluate a single HTTP header line (without terminating '\n')
+//  - returns 1 if more lines follow, 0 at end of header, -1 if reply status is not 200
+//
+int SoapESP32::soapHttpHeaderLine(char *line, size_t len, bool first, uint64_t *contentLength, bool *chunked, bool *ok)
+{
+  char *p;
+
+  line[len] = 0;
+  if (first) {
+    // first line contains status code, 206 only as answer to a range request
+    m_httpStatus = 0;
+    m_contentRange = soapRange_t();
+    if (strncmp(line, "HTTP/1.", 7) || sscanf(line + 8, "%*[ ]%d", &m_httpStatus) != 1 ||
+        (m_httpStatus != HTTP_STATUS_OK && (m_httpStatus != HTTP_STATUS_PARTIAL_CONTENT || !m_rangeRequest))) {
+      log_i("header line: %s", line);
+      return -1;
+    }
 #if CORE_DEBUG_LEVEL == 5
-    log_v("header line: %s", tmpBuffer);
+    log_v("header line: %s", line);
     delay(1);
 #endif      
+    *contentLength = 0;
+    if (chunked) *chunked = false;
+    *ok = false;
+    return 1;
   }
-  *contentLength = 0;
-  if (chunked) *chunked = false;
-  while (true) {
-    claimSPI();
-    int av = m_client->available();
-    releaseSPI();
-    if (!av) break;
-    claimSPI();
-    len = m_client->readBytesUntil('\n', tmpBuffer, sizeof(tmpBuffer) - 1);
-    releaseSPI();
-    tmpBuffer[len] = 0;
 #if CORE_DEBUG_LEVEL == 5
-    log_v("header line: %s", tmpBuffer);
-    delay(1);
+  log_v("header line: %s", line);
+  delay(1);
 #endif     
-    if (len == 1) break;      // End of header: finishing line contains only "\r\n"
-    if (!ok) {
-      if ((p = strcasestr(tmpBuffer, HEADER_CONTENT_LENGTH)) != NULL) {
-        if (sscanf(p+strlen(HEADER_CONTENT_LENGTH), "%llu", contentLength) == 1) {
-          ok = true;
-          continue;           // continue to read rest of header
-        }  
-      }
-      else if (chunked && strcasestr(tmpBuffer, HEADER_TRANS_ENC_CHUNKED)) {
-        ok = *chunked = true;
-        m_ChunkCount = 0;     // chunk size follows
-        continue;             // continue to read rest of header      
-      }
-    }  
+  if (len == 1) return 0;     // End of header: finishing line contains only "\r\n"
+  if (strncasecmp(line, HEADER_CONNECTION, strlen(HEADER_CONNECTION)) == 0 && strcasestr(line, "close")) {
+    m_conClose = true;        // server closes connection after reply
   }
-  if (ok) {
-    m_xmlReplaceState = xmlPassthrough;
-    if (chunked && *chunked) {
-      log_d("HTTP-Header ok, trailing content is chunked, no size announced"); 
+  if (strncasecmp(line, HEADER_CONTENT_RANGE, strlen(HEADER_CONTENT_RANGE)) == 0) {
+    // e.g. "Content-Range: bytes 1000-1999/5000", total size can be "*"
+    uint64_t last;
+    int n = sscanf(line + strlen(HEADER_CONTENT_RANGE), " bytes %llu-%llu/%llu", 
+                   &m_contentRange.first, &last, &m_contentRange.total);
+    if (n >= 2 && last >= m_contentRange.first) {
+      m_contentRange.size = last - m_contentRange.first + 1;
+      if (n == 2) m_contentRange.total = 0;
     }
     else {
-      log_d("HTTP-Header ok, trailing content is not chunked, announced size: %llu", *contentLength); 
+      m_contentRange = soapRange_t();
     }
   }
+  if (!*ok) {
+    if ((p = strcasestr(line, HEADER_CONTENT_LENGTH)) != NULL) {
+      if (sscanf(p+strlen(HEADER_CONTENT_LENGTH), "%llu", contentLength) == 1) {
+        *ok = true;
+      }  
+    }
+    else if (chunked && strcasestr(line, HEADER_TRANS_ENC_CHUNKED)) {
+      *ok = *chunked = true;
+      m_ChunkCount = 0;       // chunk size follows
+    }
+  }  
 
-  return ok;
+  return 1;
 }
 
 //
-// read XML data, de-chunk if needed & replace predefined XML entities that spoil MiniXPath
+// helper function, prepare reading of reply body after HTTP header has been evaluated
 //
-const replaceWith_t replaceWith[] = { {"&lt;", '<'},
-                                      {"&gt;", '>'},
-                                      {"&quot;", '"'},
-                                      {"&amp;amp;", '&'},
-                                      {"&amp;apos;", '\''},
-                                      {"&amp;quot;", '\''} }; 
-int SoapESP32::soapReadXML(bool chunked, bool replace)
+void SoapESP32::soapHttpHeaderEnd(bool ok, uint64_t contentLength, bool *chunked)
 {
-  bool match;
-  int i, c = -10;
+  if (!ok) {
+    statsEnd();
+    return;
+  }
+  statsTime(headerUs);
+  m_xmlReplaceState = xmlPassthrough;
+  m_xmlReplacePending = false;
+  m_bodyRemaining = (chunked && *chunked) ? 0 : (contentLength ? contentLength : UINT64_MAX);
+  m_chunkEnd = false;
+  m_chunkState = chunkSize;
+  m_chunkDigits = 0;
+  if (chunked && *chunked) {
+    log_d("HTTP-Header ok, trailing content is chunked, no size announced"); 
+  }
+  else {
+    log_d("HTTP-Header ok, trailing content is not chunked, announced size: %llu", contentLength); 
+  }
+}
 
-  if (!replace || (replace && (m_xmlReplaceState == xmlPassthrough))) {
-GET_MORE:    
-    if (!chunked) {
-      // data is not chunked
-      if ((c = soapClientTimedRead()) < 0) {
-        // EOF, timeout or connection closed
-        return -1;
-      }
-    }
-    else {
-      // de-chunk XML data   
-      if (m_ChunkCount <= 0) {
-        char tmpBuffer[10];
-      
-        // next line contains chunk size
-        claimSPI();
-        int len = m_client->readBytesUntil('\n', tmpBuffer, sizeof(tmpBuffer) - 1);
-        releaseSPI();
-        if (len < 2) {
-          return -2;   // we expect at least 1 digit chunk size + '\r'
-        }
-        tmpBuffer[len-1] = 0;     // replace '\r' with '\0'
-        if (sscanf(tmpBuffer, "%x", &m_ChunkCount) != 1) {
-          return -3;
-        }
-        log_d("announced chunk size: 0x%x(%d)", m_ChunkCount, m_ChunkCount);
-        if (m_ChunkCount <= 0) {
-          return -4;  // not necessarily an error...final chunk size can be 0
-        }
+//
+// predefined XML entities, looked up once the closing ';' of an entity has been found
+//  - "&amp;" in SOAP introduces an entity of the embedded DIDL-Lite ("&amp;amp;", "&amp;lt;")
+//  - DIDL-Lite quotes become apostrophes, they would spoil quoting of attribute values
+//  - DIDL-Lite '<' stays escaped, it would start a tag. Decoded when value gets scanned
+//
+const xmlEntity_t xmlEntities[] = { {"lt",   '<',  "&lt;"},
+                                    {"gt",   '>',  ">"},
+                                    {"amp",  0,    "&"},
+                                    {"quot", '"',  "'"},
+                                    {"apos", '\'', "'"} };
+
+//
+// helper function, decode entity or numeric character reference ("&#228;", "&#x2019;") at src[0] == '&'
+//  - returns number of characters put into out (max. XML_ENTITY_OUT_MAX, numeric references 
+//    become UTF-8) & sets *used to number of characters consumed from src
+//  - returns -1 if more characters are needed to decide
+//  - an invalid entity delivers '&' only, remaining characters have to be taken as they are
+//
+#define XML_ENTITY_NAME_MAX   8   // "#x10FFFF", "#1114111"
+#define XML_ENTITY_OUT_MAX    4   // "&lt;", UTF-8 sequence
+static int xmlDecodeEntity(const char *src, size_t avail, char *out, size_t *used)
+{
+  size_t start = 1, end;
+  bool level2 = false;
+
+  while (true) {
+    for (end = start; end < avail && end - start < XML_ENTITY_NAME_MAX; end++) {
+      if (!isalnum((uint8_t)src[end]) && src[end] != '#') break;
+    }
+    if (end >= avail) return -1;
+    if (src[end] != ';' || end == start) break;
+    if (!level2 && end - start == 3 && strncmp(src + start, "amp", 3) == 0) {
+      // might be followed by an entity of embedded DIDL-Lite
+      level2 = true;
+      start = end + 1;
+      continue;
+    }
+
+    const char *name = src + start;
+    size_t len = end - start;
+    *used = end + 1;
+    if (name[0] == '#') {
+      // numeric character reference
+      char *digitsEnd;
+      bool hex = (len > 1 && (name[1] == 'x' || name[1] == 'X'));
+      const char *digits = name + (hex ? 2 : 1);
+      if (!isxdigit((uint8_t)*digits)) break;
+      unsigned long cp = strtoul(digits, &digitsEnd, hex ? 16 : 10);
+      if (digitsEnd != name + len || cp == 0 || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) break;
+      if (level2 && cp == '<') {
+        memcpy(out, "&lt;", 4);
+        return 4;
       }
-      if ((c = soapClientTimedRead()) < 0) {
-        return -5;
+      if (level2 && (cp == '"' || cp == '\'')) cp = '\'';
+      if (cp < 0x80) {
+        out[0] = (char)cp;
+        return 1;
       }
-
-      // check for end of chunk
-      if (--m_ChunkCount == 0) {
-        // skip "\r\n" trailing each chunk
-        if (soapClientTimedRead() < 0 || soapClientTimedRead() < 0) {
-          return -6;   
+      if (cp < 0x800) {
+        out[0] = (char)(0xC0 | (cp >> 6));
+        out[1] = (char)(0x80 | (cp & 0x3F));
+        return 2;
+      }
+      if (cp < 0x10000) {
+        out[0] = (char)(0xE0 | (cp >> 12));
+        out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F));
+        return 3;
+      }
+      out[0] = (char)(0xF0 | (cp >> 18));
+      out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+      out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+      out[3] = (char)(0x80 | (cp & 0x3F));
+      return 4;
+    }
+    for (size_t i = 0; i < sizeof(xmlEntities) / sizeof(xmlEntity_t); i++) {
+      if (strlen(xmlEntities[i].name) == len && strncmp(name, xmlEntities[i].name, len) == 0) {
+        if (!level2) {
+          out[0] = xmlEntities[i].level1;
+          return 1;
         }
+        len = strlen(xmlEntities[i].level2);
+        memcpy(out, xmlEntities[i].level2, len);
+        return (int)len;
       }
     }
+    break;
   }
 
-  // replace predefined XML entities ("&lt;" becomes "<", etc.)
-  if (replace) {
-    if (m_xmlReplaceState == xmlPassthrough) {
-      if (c == '&') {
-        memset(m_xmlReplaceBuffer, 0, sizeof(m_xmlReplaceBuffer));
-        m_xmlReplaceBuffer[0] = '&';
-        m_xmlReplaceState = xmlAmpDetected;
-        m_xmlReplaceOffset = 1;
-        goto GET_MORE;
+  // invalid or unknown entity
+  out[0] = '&';
+  *used = level2 ? 5 : 1;
+  return 1;
+}
+
+//
+// read XML data, de-chunk if needed & replace predefined XML entities that spoil MiniXPath
+//
+int SoapESP32::soapReadXML(bool chunked, bool replace, bool wait)
+{
+  int c = -10;
+
+  // without wait SOAP_WOULD_BLOCK can be returned at any point, all states are kept in members
+  if (!replace || m_xmlReplaceState != xmlTakeFromBuffer) {
+GET_MORE:    
+    if (!chunked) {
+      // data is not chunked
+      if (m_bodyRemaining == 0 || (c = soapClientReadByte(wait)) < 0) {
+        // end of body, EOF, timeout or connection closed
+        return (c == SOAP_WOULD_BLOCK) ? c : -1;
       }
+      if (m_bodyRemaining != UINT64_MAX) m_bodyRemaining--;
     }
-    else if (m_xmlReplaceState == xmlAmpDetected) {
-      m_xmlReplaceBuffer[m_xmlReplaceOffset++] = c;
-      // run through all predefined sequences and see if we still match
-      for (match = false, i = 0; i < sizeof(replaceWith)/sizeof(replaceWith_t) && !match; i++) {
-        if (strncmp(m_xmlReplaceBuffer, replaceWith[i].replace, m_xmlReplaceOffset) == 0) {
-          match = true;
-          break;
-        }
-      }
-      if (!match) {
-        // single '&' or sequence we don't replace
-        c = '&';
-        m_xmlReplaceState = xmlTakeFromBuffer;  
-        m_xmlReplaceOffset = 1;
+    else {
+      // de-chunk XML data, framing gets consumed only when the chunk data in receive buffer is used up
+      if (m_chunkState != chunkData || m_rxHead >= m_rxTail) {
+        int n = soapChunkData(wait);
+        if (n < 0) return (n == -1) ? -5 : n;  // -4: not necessarily an error...final chunk size is 0
       }
-      else {  // match
-        if (m_xmlReplaceOffset < strlen(replaceWith[i].replace)) {
+      c = m_rxBuffer[m_rxHead++];
+      soapChunkConsume(1);
+    }
+
+    // replace predefined XML entities ("&lt;" becomes "<", etc.)
+    if (replace) {
+      if (m_xmlReplaceState == xmlPassthrough) {
+        if (c == '&') {
+          m_xmlReplaceBuffer[0] = '&';
+          m_xmlReplaceLength = 1;
+          m_xmlReplaceState = xmlAmpDetected;
           goto GET_MORE;
         }
-        else {
-          // found full sequence to be replaced
-          c = replaceWith[i].with;  
-          m_xmlReplaceState = xmlPassthrough;
-        }
+      }
+      else {
+        // xmlAmpDetected: collect characters until entity can be decoded
+        char out[XML_ENTITY_OUT_MAX];
+        size_t used, rest;
+        m_xmlReplaceBuffer[m_xmlReplaceLength++] = c;
+        int len = xmlDecodeEntity(m_xmlReplaceBuffer, m_xmlReplaceLength, out, &used);
+        if (len < 0) goto GET_MORE;
+        // decoded characters are followed by those not belonging to the entity
+        rest = m_xmlReplaceLength - used;
+        m_xmlReplacePending = (c == '&' && rest > 0);
+        if (m_xmlReplacePending) rest--;
+        memmove(m_xmlReplaceBuffer + len, m_xmlReplaceBuffer + used, rest);
+        memcpy(m_xmlReplaceBuffer, out, len);
+        m_xmlReplaceLength = len + rest;
+        m_xmlReplaceOffset = 0;
+        m_xmlReplaceState = xmlTakeFromBuffer;
       }
     }
-    else {  
-      // xmlTakeFromBuffer
-      c = m_xmlReplaceBuffer[m_xmlReplaceOffset++];
-      if (m_xmlReplaceBuffer[m_xmlReplaceOffset] == '\0') {
-        m_xmlReplaceState = xmlPassthrough;
+  }
+
+  if (replace && m_xmlReplaceState == xmlTakeFromBuffer) {
+    c = (uint8_t)m_xmlReplaceBuffer[m_xmlReplaceOffset++];
+    if (m_xmlReplaceOffset >= m_xmlReplaceLength) {
+      m_xmlReplaceState = xmlPassthrough;
+      if (m_xmlReplacePending) {
+        m_xmlReplacePending = false;
+        m_xmlReplaceBuffer[0] = '&';
+        m_xmlReplaceLength = 1;
+        m_xmlReplaceState = xmlAmpDetected;
       }
     }
   }
@@ -536,654 +1233,3032 @@ GET_MORE:
 }
 
 //
-// scanning local network for media servers that offer media content
-//  - parameter is scan duration, range 5...120s (without parameter the function defaults to 60s) 
-//  - returns number of media servers found
+// helper function, like soapReadXML(chunked, true, wait) but delivers a block of up to size characters,
+// runs without entity get copied straight from receive buffer, entities completely in receive buffer
+// get decoded right there. Waits only if no character is available at all. Returns number of 
+// characters or (if none) same values as soapReadXML()
 //
-unsigned int SoapESP32::seekServer(unsigned int scanDuration)
+int SoapESP32::soapReadXMLBlock(bool chunked, char *buf, size_t size, bool wait)
 {
-  soapServerVect_t rcvd;
+  size_t n = 0;
 
-  // delete old server list
-  m_server.clear();
+  while (n < size) {
+    size_t avail = m_rxTail - m_rxHead;
+    if (!chunked) {
+      if (avail > m_bodyRemaining) avail = (size_t)m_bodyRemaining;
+    }
+    else if (m_chunkState != chunkData) {
+      avail = 0;
+    }
+    else if (avail > (size_t)m_ChunkCount) {
+      avail = m_ChunkCount;
+    }
+    if (avail > 0 && m_xmlReplaceState == xmlPassthrough) {
+      const char *src = (const char *)m_rxBuffer + m_rxHead;
+      size_t used;
+      int len;
+      if (*src != '&') {
+        const char *amp;
+        if (avail > size - n) avail = size - n;
+        if ((amp = (const char *)memchr(src, '&', avail)) != NULL) avail = amp - src;
+        memcpy(buf + n, src, avail);
+        len = used = avail;
+      }
+      else {
+        char out[XML_ENTITY_OUT_MAX];
+        len = xmlDecodeEntity(src, avail, out, &used);
+        if (len > (int)(size - n)) len = -1;
+        if (len > 0) memcpy(buf + n, out, len);
+      }
+      if (len >= 0) {
+#if CORE_DEBUG_LEVEL == 5
+        Serial.write((const uint8_t *)src, used);
+#endif
+        m_rxHead += used;
+        n += len;
+        if (chunked) soapChunkConsume(used);
+        else if (m_bodyRemaining != UINT64_MAX) m_bodyRemaining -= used;
+        continue;
+      }
+    }
+    // entity across receive buffer/chunk or block, chunk framing, end of body or receive buffer empty: 
+    // single character
+    if (n > 0 && m_rxHead >= m_rxTail) break;
+    int c = soapReadXML(chunked, true, wait && n == 0);
+    if (c < 0) return (n > 0 && c != -2 && c != -3) ? n : c;   // bad chunk size drops the block
+    buf[n++] = (char)c;
+  }
 
-  if (scanDuration > 120) scanDuration = 120;
-  else if (scanDuration < 5) scanDuration = 5;
+  return n;
+}
 
-  log_i("SSDP search for media servers started, scan duration: %d sec", scanDuration);
-  soapSSDPquery(&rcvd, scanDuration * 1000);
+//
+// helper function, take subscription id & granted duration from a header line of a SUBSCRIBE reply
+//
+static void soapSubscribeHeaderLine(const char *line, String *sid, uint32_t *granted)
+{
+  if (strncasecmp(line, HEADER_SID, strlen(HEADER_SID)) == 0) {
+    *sid = line + strlen(HEADER_SID);
+    sid->trim();
+  }
+  else if (strncasecmp(line, HEADER_TIMEOUT, strlen(HEADER_TIMEOUT)) == 0) {
+    const char *p = strcasestr(line, HEADER_TIMEOUT_SECOND);
+    if (p) *granted = strtoul(p + strlen(HEADER_TIMEOUT_SECOND), NULL, 10);   // 0 with "Second-infinite"
+  }
+}
 
-  log_i("SSDP query discovered %d media servers", rcvd.size());
-  if (rcvd.size() == 0) return 0;   // return if none detected
+//
+// helper function, turn an URL taken from device description into a path relative to server root
+//
+static void soapDescriptionUrl(const String *location, String *result, String *url)
+{
+  if (result->startsWith("/")) *result = result->substring(1);
+  *url = location->endsWith("/") ? *location : "";   // location string becomes first part of url
+  *url += *result;
+  if (url->startsWith("http://")) {
+    // remove "http://ip:port/" from begin of string
+    url->replace("http://", "");        
+    *url = url->substring(url->indexOf("/") + 1); 
+  }
+}
 
-  log_i("checking all discovered media servers for service ContentDirectory");
+//
+// helper function, take value of a child element from the sub tree captured of an element, e.g. 
+// <controlURL> of a <service>. Returns false if there's no such child element
+//
+static bool soapChildValue(const String *tree, const char *tag, String *value)
+{
+  String start = String("<") + tag + ">", end = String("</") + tag + ">";
+  int from = tree->indexOf(start), to;
+
+  if (from < 0 || (to = tree->indexOf(end, from)) < 0) return false;
+  *value = tree->substring(from + start.length(), to);
+  value->trim();
+
+  return true;
+}
 
-  int j = 0;
+//
+// helper function, fetch device description of a server and scan it for friendly name, service 
+// type "ContentDirectory" & associated control URL and event URL
+//  - parameter srv must provide ip, port & location, friendly name, control & event URL get filled in
+//  - returns true if server delivers media content
+//
+bool SoapESP32::soapGetDescription(soapServer_t *srv)
+{
   uint64_t contentSize;
-  bool chunked, gotFriendlyName, gotServiceType;
-  String result((char *)0);
+  bool chunked, gotFriendlyName = false, ok = false;
+  String result((char *)0), resultAlt((char *)0), value((char *)0);
   MiniXPath xPath, xPathAlt;
-  soapServer_t srv;
 
-  // examine all media servers that answered our SSDP multicast query
-  while (j < rcvd.size()) {
+  // try to establish connection to server and send GET request
+  if (!soapGet(srv->ip, srv->port, srv->location.c_str())) return false;
+  log_i("connected successfully to server %s:%d", srv->ip.toString().c_str(), srv->port);
 
-    // try to establish connection to server and send GET request
-    if (!soapGet(rcvd[j].ip, rcvd[j].port, rcvd[j].location.c_str())) goto end;
-    log_i("connected successfully to server %s:%d", rcvd[j].ip.toString().c_str(), rcvd[j].port);
+  // connection established
+  srv->friendlyName = "";
+  srv->controlURL = "";
+  srv->eventURL = "";
 
-    // connection established
-    srv = { .ip = rcvd[j].ip, .port = rcvd[j].port, .location = rcvd[j].location, .friendlyName = "", .controlURL = "" };
-    gotFriendlyName = false;
-    gotServiceType = false;
+  // reading HTTP header
+  if (!soapReadHttpHeader(&contentSize, &chunked)) {
+    goto end_stop;
+  }
+  if (!chunked && contentSize == 0) {  
+    log_w("announced XML size: 0, we can stop here"); 
+    goto end_stop;
+  }  
 
-    // reading HTTP header
-    if (!soapReadHttpHeader(&contentSize, &chunked)) {
-      goto end_stop_error;
+  // scan XML block for description: friendly name, then <service> elements up to the one of service 
+  // type "ContentDirectory", which holds control URL & event URL
+  xPath.setPath(&xmlParserPaths[xpFriendlyName]);
+  xPathAlt.setPath(&xmlParserPaths[xpFriendlyNameAlt]);
+  while (true) {
+    int ret = soapReadXML(chunked);
+    if (ret < 0) {
+      if (!ok) log_w("soapReadXML() returned: %d", ret); 
+      goto end_stop;
+    }       
+
+    if (!gotFriendlyName) {
+      if (xPath.getValue((char)ret, &result) ||
+          xPathAlt.getValue((char)ret, &result)) {
+        srv->friendlyName = (result.length() > 0) ? result : "Server name not provided";
+        log_d("scanned friendly name: %s", srv->friendlyName.c_str());
+        gotFriendlyName = true;
+        // we got friendly name and now set xPath for service elements which come next
+        xPath.setPath(&xmlParserPaths[xpService]);
+        xPathAlt.setPath(&xmlParserPaths[xpServiceAlt]);
+        continue;
+      }  
     }
-    if (!chunked && contentSize == 0) {  
-      log_w("announced XML size: 0, we can stop here"); 
-      goto end_stop_error;
-    }  
-
-    // scan XML block for description: friendly name, service type "ContentDirectory" & associated control URL
-    xPath.reset();
-    xPathAlt.reset();
-    xPath.setPath(&xmlParserPaths[xpFriendlyName]);
-    xPathAlt.setPath(&xmlParserPaths[xpFriendlyNameAlt]);
-    while (true) {
-      int ret = soapReadXML(chunked);
-      if (ret < 0) {
-        log_w("soapReadXML() returned: %d", ret); 
-        goto end_stop_error;
-      }       
-
-      if (!gotFriendlyName) {
-        if (xPath.getValue((char)ret, &result) ||
-            xPathAlt.getValue((char)ret, &result)) {
-          srv.friendlyName = (result.length() > 0) ? result : "Server name not provided";
-          log_d("scanned friendly name: %s", srv.friendlyName.c_str());
-          gotFriendlyName = true;
-          // we got friendly name and now set xPath for service type which comes next
-          xPath.setPath(&xmlParserPaths[xpServiceType]);
-          xPathAlt.setPath(&xmlParserPaths[xpServiceTypeAlt]);
-          continue;
-        }  
-      }
-      else if (!gotServiceType) {
-        if (xPath.getValue((char)ret, &result) ||
-            xPathAlt.getValue((char)ret, &result)) {
-          if (strstr(result.c_str(), UPNP_URN_SCHEMA_CONTENT_DIRECTORY)) {
-            log_d("server offers service: %s", result.c_str());
-            gotServiceType = true;
-            // We got service type and now set xPath for control url (follows in same <service> block)
-            xPath.setPath(&xmlParserPaths[xpControlUrl]);
-            xPathAlt.setPath(&xmlParserPaths[xpControlUrlAlt]);
-            continue;
-          }
-        }
-      }
-      else if (xPath.getValue((char)ret, &result) ||
-               xPathAlt.getValue((char)ret, &result)) {
-        // all needed infos collected
-        if (result.startsWith("/")) result = result.substring(1);
-        if (srv.location.endsWith("/")) srv.controlURL = srv.location;  // location string becomes first part of controlURL 
-        srv.controlURL += result;
-        if (srv.controlURL.startsWith("http://")) {
-          // remove "http://ip:port/" from begin of string
-          srv.controlURL.replace("http://", "");        
-          srv.controlURL = srv.controlURL.substring(srv.controlURL.indexOf("/") + 1); 
-        }
-        log_d("assigned controlURL: %s", srv.controlURL.c_str());
-        log_i("ok, this server delivers media content");
-        m_server.push_back(srv);  // add server to server list
-        goto end_stop;
+    else {
+      const String *service = NULL;
+
+      // sub tree of a <service> element completely read
+      if (xPath.getValue((char)ret, &result, NULL, true)) service = &result;
+      else if (xPathAlt.getValue((char)ret, &resultAlt, NULL, true)) service = &resultAlt;
+      if (!service || !soapChildValue(service, "serviceType", &value) || 
+          !strstr(value.c_str(), UPNP_URN_SCHEMA_CONTENT_DIRECTORY)) continue;
+      log_d("server offers service: %s", value.c_str());
+      if (!soapChildValue(service, "controlURL", &value)) continue;
+      soapDescriptionUrl(&srv->location, &value, &srv->controlURL);
+      log_d("assigned controlURL: %s", srv->controlURL.c_str());
+      log_i("ok, this server delivers media content");
+      ok = true;
+      // event URL is optional, only taken from same <service> element
+      if (soapChildValue(service, "eventSubURL", &value) && value.length()) {
+        soapDescriptionUrl(&srv->location, &value, &srv->eventURL);
       }
+      log_d("assigned eventURL: %s", srv->eventURL.c_str());
+      // all needed infos collected, rest of description is of no interest
+      break;
     }
-end_stop_error:
-    log_i("this Server does not deliver media content");
-end_stop:
-    claimSPI();
-    m_client->stop();
-    releaseSPI();
-end:
-    j++;
   }
 
-  return m_server.size();
+end_stop:
+  if (!ok) log_i("this Server does not deliver media content");
+  claimSPI();
+  m_client->stop();
+  releaseSPI();
+  if (ok) statsTime(parsedUs);
+  statsEnd();
+
+  return ok;
 }
 
 //
-// add a server manually to server list 
+// helper function, check if server is still reachable at its location with a HTTP HEAD request
+//  - any reply but 404 (location gone) counts, not all servers implement HEAD
 //
-bool SoapESP32::addServer(IPAddress ip, uint16_t port, const char *controlURL, const char *name)
+bool SoapESP32::soapCheckLocation(const soapServer_t *srv)
 {
-  soapServer_t srv;
-  unsigned int i;
-  
-  // some basic checks
-  if (!ip || !port || !name || !controlURL ||
-      strlen(name) == 0 || strlen(controlURL) == 0) {
-    log_e("at least on parameter is invalid");
+  const char *slot[slotTotal] = { NULL };
+  char line[TMP_BUFFER_SIZE_200];
+  int status = 0;
+
+  slot[slotUri] = srv->location.c_str();
+  log_d("%s:%d HEAD /%s %s", srv->ip.toString().c_str(), srv->port, slot[slotUri], HTTP_VERSION);
+  if (!soapSendRequest(srv->ip, srv->port, reqHead, slot, true)) return false;
+
+  // first line contains status code, rest of reply is not needed
+  m_rxHead = m_rxTail = 0;
+  size_t len = soapClientReadLine(line, sizeof(line) - 1);
+  line[len] = 0;
+  claimSPI();
+  m_client->stop();
+  releaseSPI();
+  statsTime(parsedUs);
+  statsEnd();
+  if (sscanf(line, "HTTP/%*u.%*u %d", &status) != 1 || status == 404) {
+    log_i("server %s:%d not available anymore, reply: %s", srv->ip.toString().c_str(), srv->port, line);
     return false;
   }
-
-  // refuse entry in list in case of identical ip & port
-  for (i = 0; i < m_server.size(); i++) {
-    if (m_server.operator[](i).ip == ip && m_server.operator[](i).port == port) break;               
-  }
-  if (i < m_server.size()) return false;
-
-  srv.ip = ip;  
-  srv.port = port;
-  srv.controlURL = controlURL;
-  srv.friendlyName = name;
-
-  // add server to list
-  m_server.push_back(srv);
+  log_i("server %s:%d still available, status: %d", srv->ip.toString().c_str(), srv->port, status);
 
   return true;
 }
 
+// device description fetched by a separate task while seekServer() goes on
+struct soapDescriptionJob_t
+{
+  soapServer_t       srv;
+#ifdef USE_ETHERNET
+  SemaphoreHandle_t *sem;           // SPI semaphore of calling SoapESP32 object
+#endif
+  bool               validate;      // only check if server is still reachable at its location
+  bool               ok;            // server delivers media content (is reachable)
+  volatile bool      done;          // description fetched & scanned
+  std::atomic<int>   refs;          // job gets deleted by the last one of seekServer() & task releasing it
+};
+
 //
-// erase all entries in server list
+// task function, fetch a single device description with own client and SoapESP32 object
 //
-void SoapESP32::clearServerList()
+void SoapESP32::soapDescriptionTask(void *arg)
 {
-  m_server.clear();
+  soapDescriptionJob_t *job = (soapDescriptionJob_t *)arg;
+
+  {
+    // own scope: client & object are gone before the task deletes itself
+#ifdef USE_ETHERNET
+    EthernetClient client;
+    SoapESP32 *soap = new (std::nothrow) SoapESP32(&client, NULL, job->sem);
+#else
+    WiFiClient client;
+    SoapESP32 *soap = new (std::nothrow) SoapESP32(&client);
+#endif
+    if (soap) {
+      soap->m_deadline = millis() + (job->validate ? SSDP_VALIDATE_DEADLINE : SSDP_DESCRIPTION_DEADLINE);
+      job->ok = job->validate ? soap->soapCheckLocation(&job->srv) : soap->soapGetDescription(&job->srv);
+      delete soap;
+    }
+    else {
+      log_e("no memory for fetching description of server %s:%d", job->srv.ip.toString().c_str(), job->srv.port);
+    }
+  }
+  job->done = true;
+  soapDescriptionRelease(job);
+  vTaskDelete(NULL);
 }
 
 //
-// helper function: scan for certain attribute
+// helper function, start fetching device description of a server, either in a separate task 
+// (with own client) or right here. The latter is done as well if no task can be created.
+//  - with validate set the server only gets checked for being reachable at its location
+//  - returns NULL if there is no memory left, otherwise job must be released with soapDescriptionRelease()
 //
-bool SoapESP32::soapScanAttribute(const String *attributes, String *result, const char *what)
+soapDescriptionJob_t *SoapESP32::soapDescriptionStart(const soapServer_t *srv, bool task, bool validate)
 {
-  int begin, end;
+  soapDescriptionJob_t *job = new (std::nothrow) soapDescriptionJob_t();
 
-  if ((begin = attributes->indexOf(what)) >= 0 &&
-      (end = attributes->indexOf("\"", begin + strlen(what) + 1)) >= begin + strlen(what) + 1) {
-    *result = attributes->substring(begin + strlen(what) + 1, end);
-    if (result->length() > 0) return true;
+  if (!job) {
+    log_e("no memory for fetching description of server %s:%d", srv->ip.toString().c_str(), srv->port);
+    return NULL;
   }
+  job->srv = *srv;
+  job->validate = validate;
+#ifdef USE_ETHERNET
+  job->sem = m_SPIsem;
+  // without SPI semaphore the Ethernet lib must not be used by several tasks
+  if (!m_SPIsem || !*m_SPIsem) task = false;
+#endif
+  if (task) {
+    job->refs = 2;
+    if (xTaskCreate(soapDescriptionTask, "soapDescription", SSDP_DESCRIPTION_STACK, job, 
+                    uxTaskPriorityGet(NULL), NULL) == pdPASS) {
+      return job;
+    }
+    log_w("could not create task, fetching description directly");
+  }
+  job->refs = 1;
+  m_deadline = millis() + (validate ? SSDP_VALIDATE_DEADLINE : SSDP_DESCRIPTION_DEADLINE);
+  job->ok = validate ? soapCheckLocation(&job->srv) : soapGetDescription(&job->srv);
+  m_deadline = 0;
+  job->done = true;
 
-  *result = "";   // empty for next call
-  if (strcmp(what, DIDL_ATTR_SEARCHABLE) != 0) 
-    log_i("attribute: \"%s\" missing.", what);
-
-  return false;
+  return job;
 }
 
 //
-// scan <container> content in SOAP answer
+// helper function, give up interest in a description job, a still running task finishes it on its own
 //
-bool SoapESP32::soapScanContainer(const String *parentId, 
-                                  const String *attributes, 
-                                  const String *container, 
-                                  soapObjectVect_t *browseResult)
+void SoapESP32::soapDescriptionRelease(soapDescriptionJob_t *job)
 {
-  unsigned int i = 0;
-  soapObject_t info;
-  String str((char *)0);
-
-  log_d("function entered, parent id: %s", parentId->c_str());
-
-  // scan container id
-  if (!soapScanAttribute(attributes, &str, DIDL_ATTR_ID)) return false;           // container id is a must
-  log_d("%s\"%s\"", DIDL_ATTR_ID, str.c_str());
-  info.id = str;
+  if (--job->refs == 0) delete job;
+}
 
-  // scan parent id
-  if (!soapScanAttribute(attributes, &str, DIDL_ATTR_PARENT_ID)) return false;    // parent id is a must
-  if (!strcasestr(str.c_str(), parentId->c_str())) {
-#ifdef PARENT_ID_MUST_MATCH
-    log_e("scanned parent id \"%s\" != requested parent id \"%s\"", str.c_str(), parentId->c_str());
-    return false;
-#else
-    log_w("scanned parent id \"%s\" != requested parent id \"%s\"", str.c_str(), parentId->c_str());
-#endif  
-  }
-  info.parentId = *parentId;  
-  info.size = 0;
-  info.sizeMissing = false;
+//
+// helper function, fetch device descriptions (validate: only check reachability) of all given servers,  
+// up to m_seekParallel at once, each one in a separate task with own client
+//  - servers delivering content (reachable) get added to server list, order is kept
+//
+void SoapESP32::soapCheckServers(soapServerVect_t *servers, bool validate)
+{
+  std::vector<soapDescriptionJob_t *> jobs;
+  bool task = (m_seekParallel > 1 && servers->size() > 1);
+  unsigned int running;
 
-  // scan child count...not always provided (e.g. Kodi)
-  if (!soapScanAttribute(attributes, &str, DIDL_ATTR_CHILD_COUNT)) { 
-    info.sizeMissing = true;
-  }
-  else {
-    log_d("%s\"%s\"", DIDL_ATTR_CHILD_COUNT, str.c_str());
-    if ((info.size = (int)str.toInt()) == 0) {
-      log_i("container \"%s\" child count=0", info.id.c_str());
+  while (true) {
+    running = 0;
+    for (int j = 0; j < jobs.size(); j++) {
+      if (jobs[j] && !jobs[j]->done) running++;
     }
-  }
-
-  // scan searchable flag...not always provided (e.g. UMS)
-  if (!soapScanAttribute(attributes, &str, DIDL_ATTR_SEARCHABLE)) {
-    log_i("attribute \"%s\" is missing, we set it true", DIDL_ATTR_SEARCHABLE);
-    info.searchable = true;
-  }  
-  else {
-    log_d("%s\"%s\"", DIDL_ATTR_SEARCHABLE, str.c_str());
-    info.searchable = (1 == (int)str.toInt()) ? true : false;
-    if (!info.searchable) {
-      log_i("\"%s\" attribute searchable=0", info.id.c_str());
+    if (jobs.size() == servers->size() && !running) break;
+    while (jobs.size() < servers->size() && running < m_seekParallel) {
+      soapDescriptionJob_t *job = soapDescriptionStart(&servers->operator[](jobs.size()), task, validate);
+      jobs.push_back(job);
+      if (job && !job->done) running++;
     }
+    if (running) delay(1);
   }
 
-  // scan container name
-  MiniXPath xPath;
-  xPath.setPath(&xmlParserPaths[xpTitle]);
-  while (i < container->length()) {
-    if (xPath.getValue((char)container->operator[](i), &str)) {
-      if (str.length() == 0) return false;    // valid title is a must
-      if (str.indexOf("amp;gt;")) str.replace("&amp;gt;",">");
-      if (str.indexOf("amp;lt;")) str.replace("&amp;lt;","<");
-      info.name = str;
-      log_d("title=\"%s\"", str.c_str());
-      break;
-    }
-    i++;
+  for (int j = 0; j < jobs.size(); j++) {
+    if (!jobs[j]) continue;
+    if (jobs[j]->ok) m_server.push_back(jobs[j]->srv);  // add server to server list
+    soapDescriptionRelease(jobs[j]);
   }
-
-  // add valid container to result list
-  info.isDirectory = true;
-  browseResult->push_back(info);
-  log_i("\"%s\" (id: \"%s\", childCount: %llu) added to list", info.name.c_str(), info.id.c_str(), info.size);
-
-  // TEST
-#if CORE_DEBUG_LEVEL >= 4  
-  delay(3);
-#elif CORE_DEBUG_LEVEL >= 2
-  delay(1);
-#endif  
-
-  return true; 
 }
 
 //
-// scan <item> content in SOAP answer
+// scanning local network for media servers that offer media content
+//  - parameter is scan duration, range 5...120s (without parameter the function defaults to 60s) 
+//  - returns number of media servers found
 //
-bool SoapESP32::soapScanItem(const String *parentId, 
-                             const String *attributes, 
-                             const String *item, 
-                             soapObjectVect_t *browseResult)
+unsigned int SoapESP32::seekServer(unsigned int scanDuration)
 {
-  soapObject_t info;
-  unsigned int i = 0;
-  int port;
-  char address[20];
-  IPAddress ip;
-  String str((char *)0);
+  soapServerVect_t rcvd;
 
-  log_d("function entered, parent id: %s", parentId->c_str());
+  soapCancelSeek();
+  // delete old server list
+  m_server.clear();
+
+  if (scanDuration > 120) scanDuration = 120;
+  else if (scanDuration < 5) scanDuration = 5;
+
+  log_i("SSDP search for media servers started, scan duration: %d sec", scanDuration);
+  soapSSDPquery(&rcvd, scanDuration * 1000);
+
+  log_i("SSDP query discovered %d media servers", rcvd.size());
+  if (rcvd.size() == 0) return 0;   // return if none detected
+
+  log_i("checking all discovered media servers for service ContentDirectory");
+
+  soapCheckServers(&rcvd, false);
+
+  return m_server.size();
+}
+
+// seeking media servers in progress, see seekServerUntil() & seekServerAsync()
+struct soapSeek_t
+{
+  soapServerVect_t rcvd;                      // servers discovered so far
+  std::vector<soapDescriptionJob_t *> jobs;   // one per discovered server, NULL once evaluated
+  soapSeekUntil_t until;                      // all 0/NULL: no conditions
+  soapServerCallback_t callback;
+  soapSeekDoneCallback_t done;                // seekServerAsync() only
+  void *arg;
+  uint32_t duration;                          // ms, max. scan duration
+  bool task;                                  // fetch device descriptions in separate tasks
+  bool listen;                                // still evaluating SSDP packets
+  uint32_t start;                             // millis() when seeking started
+  uint32_t lastNew;                           // millis() when last new server answered
+};
+
+//
+// scanning local network for media servers that offer media content, stops as soon as a condition is met
+//  - each server found gets checked right away, servers delivering content are reported to callback (optional)
+//  - parameter until holds the conditions for stopping early (NULL: none)
+//  - parameter scanDuration is max. scan duration, range 1...120s
+//  - servers still being checked when stopping early are not added to server list
+//  - returns number of media servers found
+//
+unsigned int SoapESP32::seekServerUntil(const soapSeekUntil_t *until, soapServerCallback_t callback, void *arg,
+                                        unsigned int scanDuration)
+{
+  soapSeek_t seek;
+  bool idle;
+
+  soapCancelSeek();
+  if (!soapSeekStart(&seek, until, callback, arg, scanDuration, m_seekParallel > 1)) return 0;
+  while (!soapSeekStep(&seek, &idle)) {
+    if (idle) delay(1);
+  }
+
+  return soapSeekEnd(&seek);
+}
+
+//
+// seek media servers like seekServerUntil() without blocking: poll() evaluates SSDP packets as they
+// come in, device descriptions get fetched by separate tasks. Servers delivering content are added to 
+// server list & reported to callback (optional) from poll(), done gets called at the end. An 
+// asynchronous browse/search in progress is dropped as the server list starts anew.
+//
+bool SoapESP32::seekServerAsync(const soapSeekUntil_t *until, soapServerCallback_t callback, 
+                                soapSeekDoneCallback_t done, void *arg, unsigned int scanDuration)
+{
+  if (done == NULL) return false;
+
+  soapCancelSeek();
+  if (!soapDropAsync()) return false;
+  if (!(m_seek = new (std::nothrow) soapSeek_t())) {
+    log_e("no memory for seeking media servers");
+    return false;
+  }
+  if (!soapSeekStart(m_seek, until, callback, arg, scanDuration, true)) {
+    delete m_seek;
+    m_seek = NULL;
+    return false;
+  }
+  m_seek->done = done;
+
+  return true;
+}
+
+//
+// helper function, start seeking media servers: server list gets cleared & M-SEARCH sent
+//
+bool SoapESP32::soapSeekStart(soapSeek_t *seek, const soapSeekUntil_t *until, soapServerCallback_t callback,
+                              void *arg, unsigned int scanDuration, bool task)
+{
+  // delete old server list
+  m_server.clear();
+
+  if (scanDuration > 120) scanDuration = 120;
+  else if (scanDuration < 1) scanDuration = 1;
+
+  seek->until = until ? *until : soapSeekUntil_t();
+  seek->callback = callback;
+  seek->done = NULL;
+  seek->arg = arg;
+  seek->duration = scanDuration * 1000;
+  seek->task = task;
+  seek->listen = true;
+
+  log_i("SSDP search for media servers started, max. scan duration: %d sec", scanDuration);
+  if (!soapUDPmulticast(SSDP_M_SEARCH_REPEATS, SSDP_M_SEARCH_MX_FAST)) return false;
+  seek->start = seek->lastNew = millis();
+
+  return true;
+}
+
+//
+// helper function, advance seeking media servers without waiting: evaluates one SSDP packet, starts
+// fetching device descriptions & adds servers checked meanwhile to server list
+//  - idle gets set if there was no SSDP packet to evaluate
+//  - returns true when seeking is over
+//
+bool SoapESP32::soapSeekStep(soapSeek_t *seek, bool *idle)
+{
+  const soapSeekUntil_t *until = &seek->until;
+  unsigned int running = 0;
+  int ret = ssdpNone;
+  bool stop = false;
+
+  // evaluate incoming SSDP packets until scan duration is over
+  if (seek->listen) {
+    ret = soapSSDPreceive(&seek->rcvd, seek->start);
+    if (ret == ssdpError) {
+      seek->listen = false;
+    }
+    else if (ret == ssdpNewServer) {
+      seek->lastNew = millis();
+    }
+    else if (millis() - seek->start >= seek->duration) {
+      claimSPI();
+      m_udp->stop();
+      releaseSPI();
+      seek->listen = false;
+      log_i("scan duration over, %d media servers discovered", seek->rcvd.size());
+    }
+  }
+  *idle = (ret == ssdpNone);
+
+  // check new servers, up to m_seekParallel at once
+  for (int j = 0; j < seek->jobs.size(); j++) {
+    if (seek->jobs[j] && !seek->jobs[j]->done) running++;
+  }
+  while (seek->jobs.size() < seek->rcvd.size() && running < m_seekParallel) {
+    soapDescriptionJob_t *job = soapDescriptionStart(&seek->rcvd[seek->jobs.size()], seek->task);
+    seek->jobs.push_back(job);
+    if (job && !job->done) running++;
+  }
+
+  // servers checked
+  for (int j = 0; j < seek->jobs.size() && !stop; j++) {
+    soapDescriptionJob_t *job = seek->jobs[j];
+    if (!job || !job->done) continue;
+    seek->jobs[j] = NULL;
+    if (job->ok) {
+      m_server.push_back(job->srv);  // add server to server list
+      log_i("server delivering content found within %d ms", millis() - seek->start);
+      if (seek->callback && !seek->callback(&job->srv, seek->arg)) stop = true;
+      if ((until->servers && m_server.size() >= until->servers) ||
+          (until->friendlyName && job->srv.friendlyName == until->friendlyName) ||
+          (until->udn && job->srv.udn.equalsIgnoreCase(until->udn))) stop = true;
+    }
+    soapDescriptionRelease(job);
+  }
+  if (stop) return true;
+
+  // all servers discovered so far are checked
+  if (!running && seek->jobs.size() == seek->rcvd.size()) {
+    if (!seek->listen) return true;
+    // all replies to M-SEARCH should have arrived after MX seconds
+    if (until->quietPeriod && millis() - seek->lastNew >= until->quietPeriod &&
+        millis() - seek->start >= SSDP_M_SEARCH_MX_FAST * 1000) {
+      log_i("no new server within %d ms", until->quietPeriod);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+//
+// helper function, seeking media servers is over. Returns number of media servers found
+//
+unsigned int SoapESP32::soapSeekEnd(soapSeek_t *seek)
+{
+  if (seek->listen) {
+    claimSPI();
+    m_udp->stop();
+    releaseSPI();
+  }
+  // servers still being checked are left to their tasks
+  for (int j = 0; j < seek->jobs.size(); j++) {
+    if (seek->jobs[j]) soapDescriptionRelease(seek->jobs[j]);
+  }
+  log_i("seeking stopped after %d ms, %d media servers found", millis() - seek->start, m_server.size());
+
+  return m_server.size();
+}
+
+//
+// helper function, drop seeking started by seekServerAsync()
+//
+void SoapESP32::soapCancelSeek(void)
+{
+  if (!m_seek) return;
+
+  soapSeekEnd(m_seek);
+  delete m_seek;
+  m_seek = NULL;
+  log_d("seeking media servers dropped");
+}
+
+//
+// set max. number of device descriptions seekServer() fetches at once (1: one after the other)
+//
+void SoapESP32::setSeekConcurrency(unsigned int maxParallel)
+{
+  m_seekParallel = maxParallel ? maxParallel : 1;
+}
+
+//
+// set when browse/search give up the CPU while evaluating a reply: each time interval bytes of objects 
+// have been evaluated (yieldBytes), interval ms of wall-clock time have passed (yieldWallClock, default) 
+// or never (yieldNever). Wall-clock time includes waiting for data: the client gets polled, so unless an 
+// SPI semaphore is set the task keeps the CPU while waiting as well. Other tasks of same priority get a 
+// chance to run then. A task subscribed to the task watchdog gets it fed. Only if the task watchdog
+// watches the idle task of this core the task sleeps for one tick, so tasks of lower priority incl.
+// the idle task get a turn too.
+//
+void SoapESP32::setYieldPolicy(eYieldPolicy policy, uint32_t interval)
+{
+  m_yieldPolicy = policy;
+  m_yieldInterval = interval ? interval : 1;
+  m_yieldBytes = 0;
+  m_yieldLast = millis();
+}
+
+//
+// helper function, true if the task watchdog watches the idle task of the core we are running on. Either 
+// configured (menuconfig) or added later, e.g. by enableCore1WDT()
+//
+static bool soapIdleWatched(void)
+{
+  BaseType_t core = xPortGetCoreID();
+
+#if defined(CONFIG_ESP_TASK_WDT_CHECK_IDLE_TASK_CPU0)
+  if (core == 0) return true;
+#endif
+#if defined(CONFIG_ESP_TASK_WDT_CHECK_IDLE_TASK_CPU1)
+  if (core == 1) return true;
+#endif
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 1, 0)
+  TaskHandle_t idle = xTaskGetIdleTaskHandleForCore(core);
+#else
+  TaskHandle_t idle = xTaskGetIdleTaskHandleForCPU(core);
+#endif
+
+  return idle && esp_task_wdt_status(idle) == ESP_OK;
+}
+
+//
+// helper function, bytes of reply evaluated: yield according to policy, see setYieldPolicy()
+//
+void SoapESP32::soapYield(size_t bytes)
+{
+  if (m_yieldPolicy == yieldBytes) {
+    if ((m_yieldBytes += bytes) < m_yieldInterval) return;
+    m_yieldBytes = 0;
+  }
+  else if (m_yieldPolicy == yieldWallClock) {
+    uint32_t now = millis();
+    if (now - m_yieldLast < m_yieldInterval) return;
+    m_yieldLast = now;
+  }
+  else {
+    return;
+  }
+  if (esp_task_wdt_status(NULL) == ESP_OK) esp_task_wdt_reset();   // this task is watched
+  if (soapIdleWatched()) {
+    vTaskDelay(1);        // deliberate: the idle task runs only if this task sleeps, a single tick does
+  }
+  else {
+    taskYIELD();          // no need to sleep, tasks of same priority get a turn
+  }
+}
+
+//
+// add a server manually to server list 
+//
+bool SoapESP32::addServer(IPAddress ip, uint16_t port, const char *controlURL, const char *name, const char *eventURL)
+{
+  soapServer_t srv;
+  unsigned int i;
+  
+  // some basic checks
+  if (!ip || !port || !name || !controlURL ||
+      strlen(name) == 0 || strlen(controlURL) == 0) {
+    log_e("at least on parameter is invalid");
+    return false;
+  }
+
+  // refuse entry in list in case of identical ip & port
+  for (i = 0; i < m_server.size(); i++) {
+    if (m_server.operator[](i).ip == ip && m_server.operator[](i).port == port) break;               
+  }
+  if (i < m_server.size()) return false;
+
+  srv.ip = ip;  
+  srv.port = port;
+  srv.controlURL = controlURL;
+  srv.friendlyName = name;
+  if (eventURL) srv.eventURL = eventURL;
+
+  // add server to list
+  m_server.push_back(srv);
+
+  return true;
+}
+
+//
+// erase all entries in server list
+//
+void SoapESP32::clearServerList()
+{
+  soapCancelSeek();
+  m_server.clear();
+}
+
+//
+// helper function, write a field of the server list, tabs & line breaks would spoil the format
+//
+static void soapPrintField(Print *stream, const String &field, char end)
+{
+  if (field.indexOf('\t') < 0 && field.indexOf('\r') < 0 && field.indexOf('\n') < 0) {
+    stream->print(field);
+  }
+  else {
+    for (int i = 0; i < field.length(); i++) {
+      char c = field[i];
+      stream->print((c == '\t' || c == '\r' || c == '\n') ? ' ' : c);
+    }
+  }
+  stream->print(end);
+}
+
+//
+// write server list to a stream (e.g. a file on SD card or flash), one server per line
+//  - returns false if not all data could be written
+//
+bool SoapESP32::saveServerList(Print *stream)
+{
+  if (!stream) return false;
+
+  size_t len = stream->printf("%s %u %u\n", SERVER_LIST_HEADER, SERVER_LIST_VERSION, (unsigned)m_server.size());
+  for (int i = 0; i < m_server.size(); i++) {
+    const soapServer_t *srv = &m_server[i];
+    if (!stream->printf("%s\t%u\t", srv->ip.toString().c_str(), srv->port)) return false;
+    soapPrintField(stream, srv->location, '\t');
+    soapPrintField(stream, srv->controlURL, '\t');
+    soapPrintField(stream, srv->eventURL, '\t');
+    soapPrintField(stream, srv->udn, '\t');
+    soapPrintField(stream, srv->friendlyName, '\n');
+  }
+  stream->flush();
+
+  return len > 0 && !stream->getWriteError();
+}
+
+//
+// read server list written by saveServerList() from a stream, replaces current server list
+//  - entries are taken as they are, see validateServerList()
+//  - returns false if stream does not contain a valid server list
+//
+bool SoapESP32::loadServerList(Stream *stream)
+{
+  unsigned int version, count, fields;
+  String line((char *)0);
+
+  soapCancelSeek();
+  m_server.clear();
+  // an empty stream (e.g. new file) would keep readStringUntil() waiting for the stream timeout
+  if (!stream || !stream->available()) return false;
+
+  line = stream->readStringUntil('\n');
+  if (!line.startsWith(SERVER_LIST_HEADER) ||
+      sscanf(line.c_str() + strlen(SERVER_LIST_HEADER), "%u %u", &version, &count) != 2 ||
+      version < 1 || version > SERVER_LIST_VERSION) {
+    log_w("no valid server list found");
+    return false;
+  }
+  fields = (version == 1) ? 5 : 6;
+  for (unsigned int i = 0; i < count; i++) {
+    soapServer_t srv;
+    int field[6], port, f = 0;
+
+    // ip, port, location, controlURL, eventURL (not in version 1), udn, friendlyName
+    line = stream->available() ? stream->readStringUntil('\n') : "";
+    field[0] = line.indexOf('\t');
+    for (int j = 1; j < fields && field[j - 1] >= 0; j++) field[j] = line.indexOf('\t', field[j - 1] + 1);
+    if (field[0] < 0 || field[fields - 1] < 0 ||
+        !srv.ip.fromString(line.substring(0, field[0]).c_str()) ||
+        (port = line.substring(field[0] + 1, field[1]).toInt()) <= 0 || port > 65535) {
+      log_w("server list entry %d invalid: %s", i, line.c_str());
+      m_server.clear();
+      return false;
+    }
+    srv.port = port;
+    srv.location = line.substring(field[1] + 1, field[2]);
+    srv.controlURL = line.substring(field[2] + 1, field[3]);
+    if (version > 1) srv.eventURL = line.substring(field[3] + 1, field[++f + 3]);
+    srv.udn = line.substring(field[f + 3] + 1, field[f + 4]);
+    srv.friendlyName = line.substring(field[f + 4] + 1);
+    log_d("server list entry %d: ip=%s, port=%d, loc=\"%s\"", i, srv.ip.toString().c_str(), srv.port, srv.location.c_str());
+    m_server.push_back(srv);
+  }
+
+  return true;
+}
+
+//
+// check all servers in list for still being reachable at their location (HTTP HEAD), at once 
+// like seekServer() does with device descriptions
+//  - servers not reachable get removed from list
+//  - returns number of servers left
+//
+unsigned int SoapESP32::validateServerList(void)
+{
+  soapServerVect_t list;
+
+  soapCancelSeek();
+  list.swap(m_server);
+  soapCheckServers(&list, true);
+  log_i("%d of %d servers still available", m_server.size(), list.size());
+
+  return m_server.size();
+}
+
+//
+// restore server list saved with saveServerList(), e.g. at boot, instead of scanning the network 
+//  - servers not reachable anymore get removed from list
+//  - if the stream holds no valid list (stream can be NULL) or none of the servers is reachable 
+//    anymore then the local network gets scanned with seekServer(scanDuration)
+//  - returns number of media servers in list
+//
+unsigned int SoapESP32::restoreServerList(Stream *stream, unsigned int scanDuration)
+{
+  if (loadServerList(stream) && validateServerList() > 0) return m_server.size();
+
+  log_i("no server of saved server list available, scanning network");
+  return seekServer(scanDuration);
+}
+
+//
+// helper function: scan all attributes in str[start...end) in a single pass and note
+// the position of the selected DIDL attributes (first occurrence counts)
+//
+void SoapESP32::soapScanDidlAttributes(const String *str, int start, int end, didlSpan_t *attr)
+{
+  const char *s = str->c_str();
+  int i = start, nameStart, nameLength, valueStart;
+  char quote;
+
+  for (int a = 0; a < didlAttrCount; a++) attr[a].length = -1;
+  while (i < end) {
+    while (i < end && isspace((unsigned char)s[i])) i++;
+    nameStart = i;
+    while (i < end && s[i] != '=' && s[i] != '>' && s[i] != '/' && !isspace((unsigned char)s[i])) i++;
+    nameLength = i - nameStart;
+    while (i < end && isspace((unsigned char)s[i])) i++;
+    if (i >= end || s[i] != '=') {
+      if (nameLength == 0) i++;   // skip stray character
+      continue;                   // attribute without value
+    }
+    i++;
+    while (i < end && isspace((unsigned char)s[i])) i++;
+    if (i >= end) break;
+    quote = s[i];
+    if (quote != '"' && quote != '\'') {
+      while (i < end && !isspace((unsigned char)s[i])) i++;   // unquoted value, not for us
+      continue;
+    }
+    valueStart = ++i;
+    while (i < end && s[i] != quote) i++;
+    if (i >= end) break;          // unterminated value
+    for (int a = 0; a < didlAttrCount; a++) {
+      // names in didlAttributes[] include the trailing '='
+      if (attr[a].length < 0 && strlen(didlAttributes[a]) == nameLength + 1 &&
+          strncmp(s + nameStart, didlAttributes[a], nameLength) == 0) {
+        attr[a].start = valueStart;
+        attr[a].length = i - valueStart;
+        break;
+      }
+    }
+    i++;
+  }
+}
+
+//
+// helper function: scan <container>/<item> content in a single pass and note the position
+// of the selected top level DIDL elements (first occurrence counts) and the attributes of <res>
+//
+void SoapESP32::soapScanDidlElements(const String *content, didlSpan_t *value, didlSpan_t *resAttr)
+{
+  const char *s = content->c_str(), *p;
+  int len = content->length(), i = 0, level = 0, nameStart, nameLength, tagEnd, textStart, textEnd;
+  bool selfClosing;
+  char quote;
+
+  for (int e = 0; e < didlElementCount; e++) value[e].length = -1;
+  resAttr->start = 0;
+  resAttr->length = -1;
+  while (i < len) {
+    if ((p = (const char *)memchr(s + i, '<', len - i)) == NULL) break;
+    i = p - s + 1;
+    if (i >= len) break;
+    if (s[i] == '!' || s[i] == '?') {
+      // comment, CDATA section or processing instruction
+      const char *term = ">";
+      if (strncmp(s + i, "!--", 3) == 0) term = "-->";
+      else if (strncmp(s + i, "![CDATA[", 8) == 0) term = "]]>";
+      if ((p = strstr(s + i, term)) == NULL) break;
+      i = p - s + strlen(term);
+      continue;
+    }
+    if (s[i] == '/') {
+      // end tag
+      if ((p = (const char *)memchr(s + i, '>', len - i)) == NULL) break;
+      i = p - s + 1;
+      if (level > 0) level--;
+      continue;
+    }
+    nameStart = i;
+    while (i < len && s[i] != '>' && s[i] != '/' && !isspace((unsigned char)s[i])) i++;
+    nameLength = i - nameStart;
+    // find end of start tag, '>' inside quoted attribute values doesn't count
+    for (quote = 0, tagEnd = i; tagEnd < len; tagEnd++) {
+      if (quote) {
+        if (s[tagEnd] == quote) quote = 0;
+      }
+      else if (s[tagEnd] == '"' || s[tagEnd] == '\'') {
+        quote = s[tagEnd];
+      }
+      else if (s[tagEnd] == '>') {
+        break;
+      }
+    }
+    if (tagEnd >= len) break;
+    selfClosing = (s[tagEnd - 1] == '/');
+    if (level == 0) {
+      for (int e = 0; e < didlElementCount; e++) {
+        if (value[e].length < 0 && strlen(didlElements[e]) == nameLength && 
+            strncmp(s + nameStart, didlElements[e], nameLength) == 0) {
+          if (e == didlRes) {
+            resAttr->start = i;
+            resAttr->length = (selfClosing ? tagEnd - 1 : tagEnd) - i;
+          }
+          // element text ends with next tag, leading & trailing whitespace removed
+          textStart = tagEnd + 1;
+          textEnd = textStart;
+          if (!selfClosing) {
+            p = (const char *)memchr(s + textStart, '<', len - textStart);
+            textEnd = p ? p - s : len;
+            while (textStart < textEnd && isspace((unsigned char)s[textStart])) textStart++;
+            while (textEnd > textStart && isspace((unsigned char)s[textEnd - 1])) textEnd--;
+          }
+          value[e].start = textStart;
+          value[e].length = textEnd - textStart;
+          break;
+        }
+      }
+    }
+    if (!selfClosing) level++;
+    i = tagEnd + 1;
+  }
+}
+
+//
+// helper function: deliver a scanned value, "&lt;" left escaped by soapReadXML() becomes '<'
+//
+static void soapScanText(const String *str, const didlSpan_t *span, String *result)
+{
+  const char *p = str->c_str() + span->start, *end = p + span->length, *amp;
+
+  if ((amp = (const char *)memchr(p, '&', span->length)) == NULL) {
+    *result = str->substring(span->start, span->start + span->length);
+    return;
+  }
+  *result = "";
+  result->reserve(span->length);
+  while (amp) {
+    result->concat(p, amp - p);
+    if (end - amp >= 4 && strncmp(amp, "&lt;", 4) == 0) {
+      *result += '<';
+      p = amp + 4;
+    }
+    else {
+      *result += '&';
+      p = amp + 1;
+    }
+    amp = (const char *)memchr(p, '&', end - p);
+  }
+  result->concat(p, end - p);
+}
+
+//
+// helper function: deliver a scanned attribute
+//
+bool SoapESP32::soapScanAttribute(const String *str, const didlSpan_t *attr, eDidlAttr what, String *result)
+{
+  if (attr[what].length > 0) {
+    soapScanText(str, &attr[what], result);
+    return true;
+  }
+
+  *result = "";   // empty for next call
+  if (what != didlAttrSearchable) 
+    log_i("attribute: \"%s\" missing.", didlAttributes[what]);
+
+  return false;
+}
+
+//
+// scan <container> content in SOAP answer
+//
+bool SoapESP32::soapScanContainer(const String *parentId, 
+                                  const String *attributes, 
+                                  const String *container, 
+                                  soapObjectVect_t *browseResult)
+{
+  soapObject_t info;
+  didlSpan_t attr[didlAttrCount], value[didlElementCount], resAttr;
+  String str((char *)0);
+
+  log_d("function entered, parent id: %s", parentId->c_str());
+
+  soapScanDidlAttributes(attributes, 0, attributes->length(), attr);
+
+  // scan container id
+  if (!soapScanAttribute(attributes, attr, didlAttrId, &str)) return false;         // container id is a must
+  log_d("%s\"%s\"", DIDL_ATTR_ID, str.c_str());
+  info.id = str;
+
+  // scan parent id
+  if (!soapScanAttribute(attributes, attr, didlAttrParentId, &str)) return false;   // parent id is a must
+  if (!strcasestr(str.c_str(), parentId->c_str())) {
+#ifdef PARENT_ID_MUST_MATCH
+    log_e("scanned parent id \"%s\" != requested parent id \"%s\"", str.c_str(), parentId->c_str());
+    return false;
+#else
+    log_w("scanned parent id \"%s\" != requested parent id \"%s\"", str.c_str(), parentId->c_str());
+#endif  
+  }
+  info.parentId = *parentId;  
+  info.size = 0;
+  info.sizeMissing = false;
+
+  // scan child count...not always provided (e.g. Kodi)
+  if (!soapScanAttribute(attributes, attr, didlAttrChildCount, &str)) { 
+    info.sizeMissing = true;
+  }
+  else {
+    log_d("%s\"%s\"", DIDL_ATTR_CHILD_COUNT, str.c_str());
+    if ((info.size = (int)str.toInt()) == 0) {
+      log_i("container \"%s\" child count=0", info.id.c_str());
+    }
+  }
+
+  // scan searchable flag...not always provided (e.g. UMS)
+  if (!soapScanAttribute(attributes, attr, didlAttrSearchable, &str)) {
+    log_i("attribute \"%s\" is missing, we set it true", DIDL_ATTR_SEARCHABLE);
+    info.searchable = true;
+  }  
+  else {
+    log_d("%s\"%s\"", DIDL_ATTR_SEARCHABLE, str.c_str());
+    info.searchable = (1 == (int)str.toInt()) ? true : false;
+    if (!info.searchable) {
+      log_i("\"%s\" attribute searchable=0", info.id.c_str());
+    }
+  }
+
+  // scan container name
+  soapScanDidlElements(container, value, &resAttr);
+  if (value[didlTitle].length >= 0) {
+    if (value[didlTitle].length == 0) return false;    // valid title is a must
+    soapScanText(container, &value[didlTitle], &str);
+    info.name = str;
+    log_d("title=\"%s\"", str.c_str());
+  }
+
+  // add valid container to result list
+  info.isDirectory = true;
+  browseResult->push_back(info);
+  log_i("\"%s\" (id: \"%s\", childCount: %llu) added to list", info.name.c_str(), info.id.c_str(), info.size);
+
+  return true; 
+}
+
+//
+// scan <item> content in SOAP answer
+//
+bool SoapESP32::soapScanItem(const String *parentId, 
+                             const String *attributes, 
+                             const String *item, 
+                             soapObjectVect_t *browseResult)
+{
+  soapObject_t info;
+  didlSpan_t attr[didlAttrCount], value[didlElementCount], resAttr;
+  int port;
+  char address[20];
+  IPAddress ip;
+  String str((char *)0);
+
+  log_d("function entered, parent id: %s", parentId->c_str());
+
+  soapScanDidlAttributes(attributes, 0, attributes->length(), attr);
 
   // scan item id
-  if (!soapScanAttribute(attributes, &str, DIDL_ATTR_ID)) return false;         // id is a must
+  if (!soapScanAttribute(attributes, attr, didlAttrId, &str)) return false;         // id is a must
   log_d("%s\"%s\"", DIDL_ATTR_ID, str.c_str());
   info.id = str; 
 
-  // scan parent id
-  if (!soapScanAttribute(attributes, &str, DIDL_ATTR_PARENT_ID)) return false;  // parent id is a must
-  if (!strcasestr(str.c_str(), parentId->c_str())) {
-#ifdef PARENT_ID_MUST_MATCH
-    log_e("scanned parent id \"%s\" != requested parent id \"%s\"", str.c_str(), parentId->c_str());
+  // scan parent id
+  if (!soapScanAttribute(attributes, attr, didlAttrParentId, &str)) return false;   // parent id is a must
+  if (!strcasestr(str.c_str(), parentId->c_str())) {
+#ifdef PARENT_ID_MUST_MATCH
+    log_e("scanned parent id \"%s\" != requested parent id \"%s\"", str.c_str(), parentId->c_str());
+    return false;
+#else
+    log_w("scanned parent id \"%s\" != requested parent id \"%s\"", str.c_str(), parentId->c_str());
+#endif
+  }
+
+  info.parentId = *parentId; 
+  info.fileType = fileTypeOther;
+  info.album = "";
+  info.artist = "";
+  info.genre = "";
+  info.bitrate = 0;
+  info.sampleFrequency = 0;
+  info.size = 0;
+  info.sizeMissing = false;
+
+  // scan for uri, size, album (sometimes dir name when picture file) and title, artist (when audio file)
+  soapScanDidlElements(item, value, &resAttr);
+  if (value[didlTitle].length < 0 || value[didlRes].length < 0) {
+    log_i("title or ressource info missing, file not added to list");
+    return false;   // title & ressource info is a must
+  }  
+  if (value[didlTitle].length == 0) return false;    // valid title is a must 
+  soapScanText(item, &value[didlTitle], &info.name);
+  log_d("%s=\"%s\"", didlElements[didlTitle], info.name.c_str());
+  if (value[didlAlbum].length >= 0) {
+    // missing album not a showstopper
+    soapScanText(item, &value[didlAlbum], &info.album);
+    log_d("%s=\"%s\"", didlElements[didlAlbum], info.album.c_str());
+  }
+  if (value[didlArtist].length >= 0) {
+    // missing artist not a showstopper
+    soapScanText(item, &value[didlArtist], &info.artist);
+    log_d("%s=\"%s\"", didlElements[didlArtist], info.artist.c_str());
+  }
+  if (value[didlGenre].length >= 0) {
+    // missing genre not a showstopper
+    soapScanText(item, &value[didlGenre], &info.genre);
+    log_d("%s=\"%s\"", didlElements[didlGenre], info.genre.c_str());
+  }
+  if (value[didlClass].length >= 0) {
+    str = item->substring(value[didlClass].start, value[didlClass].start + value[didlClass].length);
+    log_d("%s=\"%s\"", didlElements[didlClass], str.c_str());
+    if (str.indexOf("audioItem") >= 0) 
+      info.fileType = fileTypeAudio;
+    else if (str.indexOf("imageItem") >= 0) 
+      info.fileType = fileTypeImage;
+    else if (str.indexOf("videoItem")) 
+      info.fileType = fileTypeVideo;
+    else 
+      info.fileType = fileTypeOther;
+  }
+
+  str = item->substring(value[didlRes].start, value[didlRes].start + value[didlRes].length);
+  if (str.startsWith("http://")) {
+    // scan for download ip & port
+    if (sscanf(str.c_str(), "http://%[0-9.]:%d/", address, &port) != 2) return false;
+    info.downloadPort = (uint16_t)port;
+    if (!ip.fromString(address)) return false;
+    info.downloadIp = ip;
+    // remove "http://ip:port/" from begin of string
+    str.replace("http://", "");        
+    info.uri = str.substring(str.indexOf("/") + 1); 
+  }
+  else {
+    info.uri = str;
+  }
+  if (info.uri.length() == 0) return false;   // valid URI is a must     
+  log_d("uri=\"%s\"", info.uri.c_str());
+
+  // scan item size
+  soapScanDidlAttributes(item, resAttr.start, resAttr.start + resAttr.length, attr);
+  if (!soapScanAttribute(item, attr, didlAttrSize, &str)) {
+    // indicates missing attribute "size" (e.g. Kodi audio files, Fritzbox/Serviio stream items)
+    info.sizeMissing = true;
+  } 
+  else {
+    info.size = strtoull(str.c_str(), NULL, 10);
+    log_d("size=%llu", info.size);
+  }
+#if !defined(SHOW_EMPTY_FILES)
+  if (info.size == 0 && !info.sizeMissing) {        
+    log_w("reported size=0, item ignored"); 
+    return false;
+  }
+#endif        
+
+  // scan bitrate (often provided when audio file)
+  if (soapScanAttribute(item, attr, didlAttrBitrate, &str)) {
+    info.bitrate = (size_t)str.toInt();
+    if (info.bitrate == 0) {
+      log_w("bitrate=0 !"); 
+    }              
+    else { 
+      log_d("bitrate=%d", info.bitrate);
+    }  
+  }  
+
+  // scan sample frequency (often provided when audio file)
+  if (soapScanAttribute(item, attr, didlAttrSampleFrequ, &str)) {
+    info.sampleFrequency = (size_t)str.toInt();
+    if (info.sampleFrequency == 0) {
+      log_w("sampleFrequency=0");   
+    }            
+    else { 
+      log_d("sampleFrequency=%d", info.sampleFrequency);
+    }  
+  }  
+#if !defined(NO_PROTOCOL_INFO)
+  // info about media format, gets important when extension e.g. ".mp3" is missing in id and url
+  if (soapScanAttribute(item, attr, didlAttrProtInfo, &str)) {
+    info.protInfo = str;
+    if (info.protInfo.length() == 0) {
+      log_w("protocolInfo=\"\" (undefined)");   
+    }            
+    else { 
+      log_d("protocolInfo=\"%s\"", info.protInfo.c_str());
+    }  
+  }  
+#endif
+
+  // add valid file to result list
+  info.isDirectory = false;
+  browseResult->push_back(info);
+
+  log_i("\"%s\" (id: \"%s\", size: %llu, sizeMissing: %s, type: %s) added to list", 
+        info.name.c_str(), info.id.c_str(), info.size, info.sizeMissing ? "true" : "false", getFileTypeName(info.fileType));
+
+  return true;
+}
+
+//
+// Process browse and search requests
+//
+bool SoapESP32::soapProcessRequest(const unsigned int srv,         // server number in list
+                                   const char *objectId,           // directory to search, "0" represents root according to spec
+                                   soapObjectVect_t *result,       // where to store browse/search results
+                                   const char *searchCriteria,     // what to search for, e.g. "upnp:artist contains \"Name\""
+                                   const char *sortCriteria,       // sort criteria for results returned
+                                   const uint32_t startingIndex,   // offset into content list
+                                   const uint16_t maxCount,        // limits number of objects in result list
+                                   soapObjectCallback_t callback,  // if set: called for each object instead of storing it
+                                   void *arg,                      // passed to callback
+                                   soapPageInfo_t *page)           // if set: receives counters reported by server
+{
+  if (srv >= m_server.size()) {
+    log_e("invalid server number: %d", srv);
+    return false;
+  }
+
+  bool search = (searchCriteria != NULL);
+  if (search)
+    log_i("search server: \"%s\", objectId: \"%s\", searchCriteria: %s, sortCriteria: %s", 
+           m_server[srv].friendlyName.c_str(), objectId, searchCriteria, sortCriteria);
+  else 
+    log_i("browse server: \"%s\", objectId: \"%s\"", m_server[srv].friendlyName.c_str(), objectId);
+
+  if (startingIndex != (search ? SOAP_DEFAULT_SEARCH_STARTING_INDEX : SOAP_DEFAULT_BROWSE_STARTING_INDEX)) 
+    log_d("special parameter for \"startingIndex\": %d", startingIndex);
+  if (maxCount != (search ? SOAP_DEFAULT_SEARCH_MAX_COUNT : SOAP_DEFAULT_BROWSE_MAX_COUNT)) 
+    log_d("special parameter for \"maxCount\": %d", maxCount);
+
+  // answer from cache if possible
+  uint32_t hash = 0;
+  if (m_cacheMax) {
+    hash = soapCacheHash(objectId, searchCriteria, sortCriteria, startingIndex, maxCount);
+    soapCacheEntry_t *entry = soapCacheFind(srv, hash, objectId, searchCriteria, sortCriteria, startingIndex, maxCount);
+    if (entry) {
+      m_cacheStats.hits++;
+      log_i("answered from cache (%d objects)", entry->result.size());
+      statsStart();
+      statsSet(cached, true);
+      statsSet(objects, entry->result.size());
+      bool ret = soapCacheReplay(entry, result, callback, arg, page);
+      statsTime(parsedUs);
+      statsEnd();
+      return ret;
+    }
+    m_cacheStats.misses++;
+  }
+
+  // send SOAP browse/search request to server
+  if (!soapPost(m_server[srv].ip, m_server[srv].port, m_server[srv].controlURL.c_str(), objectId,
+                searchCriteria, sortCriteria, startingIndex, maxCount)) {
+    return false;
+  }  
+  log_i("connected successfully to server %s:%d", m_server[srv].ip.toString().c_str(), m_server[srv].port);
+
+  if (!m_cacheMax) return soapProcessReply(objectId, search, result, callback, arg, page);
+
+  // collect result for the cache on the way, a SoapResultSet of the caller gets copied afterwards
+  soapPageInfo_t info = { UINT32_MAX, 0, 0, false };   // numberReturned stays UINT32_MAX if reply is incomplete
+  SoapResultSet collected;
+  const SoapResultSet *set = (callback == soapResultSetAdd) ? (const SoapResultSet *)arg : &collected;
+  soapCacheFill_t fill = { .set = &collected, .result = result, .callback = callback, .arg = arg };
+
+  if (set == &collected) {
+    collected.setMemoryLimit(m_cacheMax);
+    collected.clear(objectId);
+    if (result) result->clear();
+    callback = soapCacheAdd;
+    arg = &fill;
+  }
+  if (!soapProcessReply(objectId, search, NULL, callback, arg, &info)) return false;
+  if (info.numberReturned == UINT32_MAX) return true;     // incomplete or stopped by callback
+
+  if (page) *page = info;
+  if (!set->full()) {
+    soapCacheStore(srv, hash, objectId, searchCriteria, sortCriteria, startingIndex, maxCount, set, &info);
+  }
+
+  return true;
+}
+
+//
+// helper function, look up cached result of a browse/search request
+//
+soapCacheEntry_t *SoapESP32::soapCacheFind(const unsigned int srv, uint32_t hash, const char *objectId, 
+                                           const char *searchCriteria, const char *sortCriteria, 
+                                           const uint32_t startingIndex, const uint16_t maxCount)
+{
+  for (soapCacheEntry_t *entry : m_cache) {
+    if (entry->hash == hash && entry->ip == m_server[srv].ip && entry->port == m_server[srv].port &&
+        entry->startingIndex == startingIndex && entry->maxCount == maxCount && 
+        entry->search == (searchCriteria != NULL) && entry->objectId == objectId &&
+        entry->searchCriteria == (searchCriteria ? searchCriteria : "") && 
+        entry->sortCriteria == (sortCriteria ? sortCriteria : "")) {
+      entry->lastUsed = ++m_cacheTick;
+      return entry;
+    }
+  }
+
+  return NULL;
+}
+
+//
+// helper function, deliver cached result like a reply from server
+//  - a SoapResultSet of the caller simply gets a copy of the cached set
+//
+bool SoapESP32::soapCacheReplay(soapCacheEntry_t *entry, soapObjectVect_t *result, soapObjectCallback_t callback, 
+                                void *arg, soapPageInfo_t *page)
+{
+  if (callback == soapResultSetAdd) {
+    ((SoapResultSet *)arg)->assign(&entry->result);
+  }
+  else if (callback) {
+    soapObject_t object;
+
+    for (size_t i = 0; i < entry->result.size(); i++) {
+      entry->result.getObject(i, &object);
+      if (!callback(&object, arg)) {
+        log_i("stopped by callback");
+        return true;        // like an incomplete reply, page isn't reported
+      }
+    }
+  }
+  else {
+    result->clear();
+    result->reserve(entry->result.size());
+    for (size_t i = 0; i < entry->result.size(); i++) {
+      result->emplace_back();
+      entry->result.getObject(i, &result->back());
+    }
+  }
+  if (page) *page = entry->page;
+
+  return true;
+}
+
+//
+// helper function, add a complete browse/search result to the cache
+//
+void SoapESP32::soapCacheStore(const unsigned int srv, uint32_t hash, const char *objectId, const char *searchCriteria,
+                               const char *sortCriteria, const uint32_t startingIndex, const uint16_t maxCount,
+                               const SoapResultSet *set, const soapPageInfo_t *page)
+{
+  // a changed container update id outdates everything cached for this container
+  if (page->updateIdValid) soapCacheDrop(m_server[srv].ip, m_server[srv].port, objectId, page);
+
+  soapCacheEntry_t *entry = new (std::nothrow) soapCacheEntry_t;
+  if (!entry) return;
+  entry->result.setMemoryLimit(m_cacheMax);
+  if (!entry->result.assign(set)) {
+    delete entry;
+    return;
+  }
+  entry->hash = hash;
+  entry->ip = m_server[srv].ip;
+  entry->port = m_server[srv].port;
+  entry->search = (searchCriteria != NULL);
+  entry->objectId = objectId;
+  entry->searchCriteria = searchCriteria ? searchCriteria : "";
+  entry->sortCriteria = sortCriteria ? sortCriteria : "";
+  entry->startingIndex = startingIndex;
+  entry->maxCount = maxCount;
+  entry->page = *page;
+  entry->lastUsed = ++m_cacheTick;
+  entry->memory = sizeof(soapCacheEntry_t) + entry->objectId.length() + entry->searchCriteria.length() + 
+                  entry->sortCriteria.length() + entry->result.getMemoryUsage();
+  if (entry->memory > m_cacheMax) {
+    log_d("result of %d bytes exceeds cache size", entry->memory);
+    delete entry;
+    return;
+  }
+  m_cache.push_back(entry);
+  m_cacheStats.memory += entry->memory;
+  soapCacheEvict(m_cacheMax);
+  log_d("result cached, %d entries with %d bytes", m_cache.size(), m_cacheStats.memory);
+}
+
+//
+// helper function, drop cached results of a server
+//  - objectId NULL: all results of server, otherwise only those of given container
+//  - page set: only results without the update id reported
+//
+unsigned int SoapESP32::soapCacheDrop(const IPAddress ip, const uint16_t port, const char *objectId, 
+                                      const soapPageInfo_t *page)
+{
+  unsigned int dropped = 0;
+
+  for (size_t i = 0; i < m_cache.size(); ) {
+    soapCacheEntry_t *entry = m_cache[i];
+    if (entry->ip == ip && entry->port == port && (!objectId || entry->objectId == objectId) &&
+        (!page || !entry->page.updateIdValid || entry->page.updateId != page->updateId)) {
+      soapCacheErase(i);
+      dropped++;
+      continue;
+    }
+    i++;
+  }
+  if (dropped) log_d("%d cached results dropped", dropped);
+  m_cacheStats.invalidated += dropped;
+
+  return dropped;
+}
+
+//
+// helper function, drop least recently used results until cache fits into given size
+//
+void SoapESP32::soapCacheEvict(size_t maxMemory)
+{
+  while (m_cacheStats.memory > maxMemory && !m_cache.empty()) {
+    size_t oldest = 0;
+    for (size_t i = 1; i < m_cache.size(); i++) {
+      if ((int32_t)(m_cache[i]->lastUsed - m_cache[oldest]->lastUsed) < 0) oldest = i;
+    }
+    soapCacheErase(oldest);
+    m_cacheStats.evicted++;
+  }
+}
+
+//
+// helper function, remove a single entry from cache
+//
+void SoapESP32::soapCacheErase(size_t index)
+{
+  m_cacheStats.memory -= m_cache[index]->memory;
+  delete m_cache[index];
+  m_cache.erase(m_cache.begin() + index);
+}
+
+//
+// enable caching of browse/search results with given memory limit (0 disables the cache)
+//  - repeated requests with identical parameters get answered without contacting the server
+//  - results get dropped when the server reports a changed container update id with a reply
+//    or a changed SystemUpdateID (see validateCache()), least recently used ones when space is needed
+//  - paged (nextPage()) and asynchronous requests are never cached
+//
+void SoapESP32::setCache(size_t maxMemory)
+{
+  m_cacheMax = maxMemory;
+  soapCacheEvict(maxMemory);
+  m_cacheStats.maxMemory = maxMemory;
+}
+
+//
+// drop all cached results and reset cache counters
+//
+void SoapESP32::clearCache(void)
+{
+  for (soapCacheEntry_t *entry : m_cache) delete entry;
+  m_cache.clear();
+  m_systemUpdateIds.clear();
+  m_cacheStats = { 0, 0, 0, 0, 0, 0, m_cacheMax };
+}
+
+//
+// drop cached results of a server, objectId NULL: all of them, otherwise those of given container.
+// Returns number of results dropped
+//
+unsigned int SoapESP32::invalidateCache(const unsigned int srv, const char *objectId)
+{
+  if (srv >= m_server.size()) return 0;
+
+  return soapCacheDrop(m_server[srv].ip, m_server[srv].port, objectId, NULL);
+}
+
+//
+// query server's SystemUpdateID and drop all its cached results if it changed since the previous
+// call, e.g. call it before showing a cached directory again after a while
+//
+bool SoapESP32::validateCache(const unsigned int srv)
+{
+  uint32_t updateId;
+
+  if (!getSystemUpdateId(srv, &updateId)) return false;
+  if (soapSystemUpdateIdChanged(m_server[srv].ip, m_server[srv].port, updateId)) {
+    soapCacheDrop(m_server[srv].ip, m_server[srv].port, NULL, NULL);
+  }
+
+  return true;
+}
+
+//
+// helper function, remember SystemUpdateID of a server, returns true if it differs from the one seen before
+//
+bool SoapESP32::soapSystemUpdateIdChanged(const IPAddress ip, const uint16_t port, uint32_t updateId)
+{
+  for (soapSystemUpdateId_t &known : m_systemUpdateIds) {
+    if (known.ip == ip && known.port == port) {
+      if (known.updateId == updateId) return false;
+      log_i("SystemUpdateID changed from %u to %u", known.updateId, updateId);
+      known.updateId = updateId;
+      return true;
+    }
+  }
+  m_systemUpdateIds.push_back({ .ip = ip, .port = port, .updateId = updateId });
+
+  return false;
+}
+
+//
+// deliver cache counters
+//
+void SoapESP32::getCacheStats(soapCacheStats_t *stats)
+{
+  *stats = m_cacheStats;
+  stats->entries = m_cache.size();
+}
+
+//
+// Evaluate reply to browse and search requests
+//
+bool SoapESP32::soapProcessReply(const char *objectId,           // directory browsed/searched
+                                 const bool search,              // true: reply to search request
+                                 soapObjectVect_t *result,       // where to store browse/search results
+                                 soapObjectCallback_t callback,  // if set: called for each object instead of storing it
+                                 void *arg,                      // passed to callback
+                                 soapPageInfo_t *page)           // if set: receives counters reported by server
+{
+  uint64_t contentSize;
+  bool chunked = false;
+  soapReply_t reply;
+
+  // reading HTTP header
+  if (!soapReadHttpHeader(&contentSize, &chunked)) {
+    log_e("HTTP Header not ok or reply status not 200");
+    claimSPI();
+    m_client->stop();
+    releaseSPI();
+    return false;
+  }
+  if (!chunked && contentSize == 0) {  
+    log_e("announced XML size: 0 !"); 
+    claimSPI();
+    m_client->stop();
+    releaseSPI();    
+    return false;
+  } 
+  log_i("scan answer from media server:"); 
+
+  soapReplyStart(&reply, objectId, search, chunked, result, callback, arg);
+  soapReplyEnd(&reply, soapReplyParse(&reply, true) == replyDone, page);
+
+  return true;
+}
+
+//
+// helper function, prepare evaluation of browse/search reply after HTTP header has been read
+//
+void SoapESP32::soapReplyStart(soapReply_t *reply, const char *objectId, const bool search, const bool chunked,
+                               soapObjectVect_t *result, soapObjectCallback_t callback, void *arg)
+{
+  reply->objId = objectId;
+  reply->search = search;
+  reply->chunked = chunked;
+  reply->gotCount = false;
+  reply->reusable = true;
+  reply->count = reply->countContainer = reply->countItem = 0;
+  reply->info = { 0, 0, 0, false };
+  reply->callback = callback;
+  reply->arg = arg;
+  reply->xmlHead = reply->xmlTail = 0;
+
+  // time to clean result list
+  if (callback) {
+    result = &reply->single;
+    result->reserve(1);
+  }
+  result->clear();
+  reply->result = result;
+
+  int eNum = search ? xpSearchContainer : xpBrowseContainer;
+  reply->xPathSet.addPath(&xmlParserPaths[eNum++], true);     // xsContainer
+  reply->xPathSet.addPath(&xmlParserPaths[eNum++], true);     // xsItem
+  reply->xPathSet.addPath(&xmlParserPaths[eNum++]);           // xsNumberReturned
+  reply->xPathSet.addPath(&xmlParserPaths[eNum++]);           // xsTotalMatches
+  reply->xPathSet.addPath(&xmlParserPaths[eNum]);             // xsUpdateId
+  // only the first <res> of an object gets evaluated, <desc> not at all
+  reply->xPathSet.addSkip(DIDL_DESC);
+  reply->xPathSet.addSkip(didlElements[didlRes], 1);
+}
+
+//
+// helper function, scan XML/SOAP reply to browse/search request
+//  - without wait it returns replyBusy as soon as all data received so far has been scanned or
+//    after SOAP_RX_BUFFER_SIZE characters, whatever comes first
+//  - returns replyDone at end of reply, replyStopped in case of error or when stopped by callback
+//
+int SoapESP32::soapReplyParse(soapReply_t *reply, bool wait)
+{
+  soapObjectVect_t *result = reply->result;
+
+  for (int budget = SOAP_RX_BUFFER_SIZE; wait || budget > 0;) {
+    if (reply->xmlHead >= reply->xmlTail) {
+      // de-chunk data stream and replace XML-entities (if found)
+      int ret = soapReadXMLBlock(reply->chunked, reply->xml, sizeof(reply->xml), wait);
+      if (ret == SOAP_WOULD_BLOCK) return replyBusy;
+      if (ret < 0) {
+        reply->reusable = reply->chunked ? m_chunkEnd : (m_bodyRemaining == 0);
+        if (reply->gotCount) return replyDone;     // UpdateID missing, not a showstopper
+        log_e("soapReadXML() returned: %d%s", ret, ret == -1 ? " (likely EOF)" : ""); 
+        return replyStopped;
+      }
+      reply->xmlHead = 0;
+      reply->xmlTail = ret;
+    }
+    size_t used;
+    int match = reply->xPathSet.getValue(reply->xml + reply->xmlHead, reply->xmlTail - reply->xmlHead, &used,
+                                         &reply->str, &reply->strAttribute);
+    reply->xmlHead += used;
+    budget -= used;
+    if (match == xsContainer) {
+#if CORE_DEBUG_LEVEL == 5
+      log_v("container attribute (length=%d): %s", reply->strAttribute.length(), reply->strAttribute.c_str());
+      log_v("container (length=%d): %s", reply->str.length(), reply->str.c_str());
+      delay(1);
+#endif
+      soapYield(reply->strAttribute.length() + reply->str.length());
+      statsScanStart();
+      bool scanned = soapScanContainer(&reply->objId, &reply->strAttribute, &reply->str, result);
+      statsScanEnd();
+      if (!scanned) {
+        statsAdd(rejected, 1);
+      }
+      else {
+        reply->countContainer++;
+        if (reply->callback) {
+          bool proceed = reply->callback(&result->back(), reply->arg);
+          result->clear();
+          if (!proceed) {
+            log_i("stopped by callback");
+            return replyStopped;
+          }
+        }
+      }
+    }
+    else if (match == xsItem) {
+#if CORE_DEBUG_LEVEL == 5      
+      log_v("item attribute (length=%d): %s", reply->strAttribute.length(), reply->strAttribute.c_str());
+      log_v("item (length=%d): %s", reply->str.length(), reply->str.c_str());
+      delay(1);
+#endif
+      soapYield(reply->strAttribute.length() + reply->str.length());
+      statsScanStart();
+      bool scanned = soapScanItem(&reply->objId, &reply->strAttribute, &reply->str, result);
+      statsScanEnd();
+      if (!scanned) {
+        statsAdd(rejected, 1);
+      }
+      else {
+        reply->countItem++;
+        if (reply->callback) {
+          bool proceed = reply->callback(&result->back(), reply->arg);
+          result->clear();
+          if (!proceed) {
+            log_i("stopped by callback");
+            return replyStopped;
+          }
+        }
+      }
+    }
+    else if (match == xsNumberReturned) {
+      reply->count = reply->str.toInt();
+      reply->gotCount = true;
+      log_d("announced number of folders and/or files: %d", reply->count);
+    }
+    else if (match == xsTotalMatches) {
+      reply->info.totalMatches = strtoul(reply->str.c_str(), NULL, 10);
+      log_d("total matches: %u", reply->info.totalMatches);
+    }
+    else if (match == xsUpdateId) {
+      reply->info.updateId = strtoul(reply->str.c_str(), NULL, 10);
+      reply->info.updateIdValid = true;
+      log_d("update id: %u", reply->info.updateId);
+      return replyDone;  // UpdateID comes last, so we can stop here
+    }
+  }
+
+  return replyBusy;
+}
+
+//
+// helper function, done with browse/search reply. Counters get reported only if the reply
+// has been scanned completely
+//
+void SoapESP32::soapReplyEnd(soapReply_t *reply, bool complete, soapPageInfo_t *page)
+{
+  if (complete) {
+    reply->info.numberReturned = reply->gotCount ? reply->count : reply->countContainer + reply->countItem;
+    if (page) *page = reply->info;
+
+    if (reply->count == 0) {
+      log_i("XML scanned, no elements announced");
+    }
+    else if (reply->count != (reply->countContainer + reply->countItem)) {
+      log_w("XML scanned, elements announced %d != found %d (possible reason: empty file or vital attributes missing)", 
+             reply->count, reply->countContainer + reply->countItem);
+    }
+    statsTime(parsedUs);
+  }
+  statsSet(objects, reply->countContainer + reply->countItem);
+  soapClientRelease(reply->reusable && soapSkipBody(reply->chunked));
+  log_i("found %d folders and %d files", reply->countContainer, reply->countItem);
+}
+
+//
+// browse a SOAP container object (directory) on a media server for content 
+//
+bool SoapESP32::browseServer(const unsigned int srv,         // server number in list
+                             const char *objectId,           // directory to browse, "0" represents root according to spec
+                             soapObjectVect_t *browseResult, // where to store browse results (directory content)
+                             // optional parameter
+                             const uint32_t startingIndex,   // offset into directory content list
+                             const uint16_t maxCount)        // limits number of objects in result list
+{
+  return soapProcessRequest(srv, objectId, browseResult, NULL, NULL, startingIndex, maxCount);
+}
+
+//
+// browse a SOAP container object (directory) on a media server for content, results get stored
+// in a compact result set
+//
+bool SoapESP32::browseServer(const unsigned int srv,         // server number in list
+                             const char *objectId,           // directory to browse, "0" represents root according to spec
+                             SoapResultSet *browseResult,    // where to store browse results (directory content)
+                             // optional parameter
+                             const uint32_t startingIndex,   // offset into directory content list
+                             const uint16_t maxCount)        // limits number of objects in result list
+{
+  browseResult->clear(objectId);
+
+  return soapProcessRequest(srv, objectId, NULL, NULL, NULL, startingIndex, maxCount, soapResultSetAdd, browseResult) &&
+         !browseResult->full();
+}
+
+//
+// browse a SOAP container object (directory) on a media server, each object gets handed over 
+// to a callback as soon as it is scanned (no result list, so maxCount isn't limited by memory)
+//
+bool SoapESP32::browseServer(const unsigned int srv,         // server number in list
+                             const char *objectId,           // directory to browse, "0" represents root according to spec
+                             soapObjectCallback_t callback,  // called for each object, returns false to stop browsing
+                             // optional parameter
+                             void *arg,                      // passed to callback
+                             const uint32_t startingIndex,   // offset into directory content list
+                             const uint16_t maxCount)        // limits number of objects reported
+{
+  if (callback == NULL) return false;
+
+  return soapProcessRequest(srv, objectId, NULL, NULL, NULL, startingIndex, maxCount, callback, arg);
+}
+
+//
+// send a search request for files matching a special criteria to media server
+//
+bool SoapESP32::searchServer(const unsigned int srv,         // server number in list
+                             const char *objectId,           // start directory to search from, "0" for root
+                             soapObjectVect_t *searchResult, // where to store search results (file list)
+                             const char *searchCriteria1,    // search criteria, e.g. "dc:title contains"
+                             const char *param1,             // first criteria's parameter, e.g. "word"
+                             // optional parameter
+                             const char *searchCriteria2,    // optional search criteria, e.g. "upnp:class derivedfrom"
+                             const char *param2,             // 2nd criteria's parameter, e.g. "object.item.videoItem"
+                             const char *sortCriteria,       // optional sort criteria for results returned
+                             const uint32_t startingIndex,   // offset into content list
+                             const uint16_t maxCount)        // limits number of objects in result list
+{
+  return soapProcessSearch(srv, objectId, searchResult, NULL, NULL, searchCriteria1, param1, 
+                           searchCriteria2, param2, sortCriteria, startingIndex, maxCount);
+}
+
+//
+// send a search request for files matching a special criteria to media server, results get stored
+// in a compact result set
+//
+bool SoapESP32::searchServer(const unsigned int srv,         // server number in list
+                             const char *objectId,           // start directory to search from, "0" for root
+                             SoapResultSet *searchResult,    // where to store search results (file list)
+                             const char *searchCriteria1,    // search criteria, e.g. "dc:title contains"
+                             const char *param1,             // first criteria's parameter, e.g. "word"
+                             // optional parameter
+                             const char *searchCriteria2,    // optional search criteria, e.g. "upnp:class derivedfrom"
+                             const char *param2,             // 2nd criteria's parameter, e.g. "object.item.videoItem"
+                             const char *sortCriteria,       // optional sort criteria for results returned
+                             const uint32_t startingIndex,   // offset into content list
+                             const uint16_t maxCount)        // limits number of objects in result list
+{
+  searchResult->clear(objectId);
+
+  return soapProcessSearch(srv, objectId, NULL, soapResultSetAdd, searchResult, searchCriteria1, param1, 
+                           searchCriteria2, param2, sortCriteria, startingIndex, maxCount) &&
+         !searchResult->full();
+}
+
+//
+// send a search request for files matching a special criteria to media server, each object gets
+// handed over to a callback as soon as it is scanned
+//
+bool SoapESP32::searchServer(const unsigned int srv,         // server number in list
+                             const char *objectId,           // start directory to search from, "0" for root
+                             soapObjectCallback_t callback,  // called for each object, returns false to stop searching
+                             void *arg,                      // passed to callback
+                             const char *searchCriteria1,    // search criteria, e.g. "dc:title contains"
+                             const char *param1,             // first criteria's parameter, e.g. "word"
+                             // optional parameter
+                             const char *searchCriteria2,    // optional search criteria, e.g. "upnp:class derivedfrom"
+                             const char *param2,             // 2nd criteria's parameter, e.g. "object.item.videoItem"
+                             const char *sortCriteria,       // optional sort criteria for results returned
+                             const uint32_t startingIndex,   // offset into content list
+                             const uint16_t maxCount)        // limits number of objects reported
+{
+  if (callback == NULL) return false;
+
+  return soapProcessSearch(srv, objectId, NULL, callback, arg, searchCriteria1, param1, 
+                           searchCriteria2, param2, sortCriteria, startingIndex, maxCount);
+}
+
+//
+// assemble search criteria and process search request
+//
+bool SoapESP32::soapProcessSearch(const unsigned int srv, const char *objectId, soapObjectVect_t *result, 
+                                  soapObjectCallback_t callback, void *arg, const char *searchCriteria1, const char *param1, 
+                                  const char *searchCriteria2, const char *param2, const char *sortCriteria, 
+                                  const uint32_t startingIndex, const uint16_t maxCount)
+{
+  String search((char *)0), sort((char *)0);
+
+  if (searchCriteria1 == NULL) return false;
+  soapSearchCriteria(&search, &sort, searchCriteria1, param1, searchCriteria2, param2, sortCriteria);
+
+  return soapProcessRequest(srv, objectId, result, search.c_str(), sort.c_str(), startingIndex, maxCount, callback, arg);
+}
+
+//
+// assemble final search & sort criteria strings
+//
+void SoapESP32::soapSearchCriteria(String *search, String *sort, const char *searchCriteria1, const char *param1, 
+                                   const char *searchCriteria2, const char *param2, const char *sortCriteria)
+{
+  *search = "";
+  if (param1 != NULL) 
+    *search = String(searchCriteria1) + " \"" + param1 + "\"";
+  if (searchCriteria2 != NULL) 
+    *search += String(" and ") + searchCriteria2;
+  if (param2 != NULL) 
+    *search += String(" \"") + param2 + "\"";
+
+  // define sort criteria string  
+  *sort = (sortCriteria == NULL) ? SOAP_DEFAULT_SEARCH_SORT_CRITERIA : sortCriteria;
+}
+
+//
+// prepare paged browsing of a container, pages get delivered by nextPage()
+//
+bool SoapESP32::browseStart(const unsigned int srv,         // server number in list
+                            const char *objectId,           // directory to browse, "0" represents root according to spec
+                            soapCursor_t *cursor,           // keeps state of paged browsing
+                            // optional parameter
+                            const uint16_t pageSize)        // objects per page
+{
+  if (srv >= m_server.size() || pageSize == 0) return false;
+
+  cursor->srv = srv;
+  cursor->objectId = objectId;
+  cursor->search = false;
+  cursor->searchCriteria = "";
+  cursor->sortCriteria = "";
+  cursor->pageSize = pageSize;
+  cursor->startingIndex = 0;
+  cursor->totalMatches = 0;
+  cursor->pages = 0;
+  cursor->updateId = 0;
+  cursor->updateIdChanged = false;
+  cursor->prefetchTag = 0;
+  cursor->done = false;
+
+  return true;
+}
+
+//
+// prepare paged search, pages get delivered by nextPage()
+//
+bool SoapESP32::searchStart(const unsigned int srv,         // server number in list
+                            const char *objectId,           // start directory to search from, "0" for root
+                            soapCursor_t *cursor,           // keeps state of paged search
+                            const char *searchCriteria1,    // search criteria, e.g. "dc:title contains"
+                            const char *param1,             // first criteria's parameter, e.g. "word"
+                            // optional parameter
+                            const char *searchCriteria2,    // optional search criteria, e.g. "upnp:class derivedfrom"
+                            const char *param2,             // 2nd criteria's parameter, e.g. "object.item.videoItem"
+                            const char *sortCriteria,       // optional sort criteria for results returned
+                            const uint16_t pageSize)        // objects per page
+{
+  if (searchCriteria1 == NULL || !browseStart(srv, objectId, cursor, pageSize)) return false;
+
+  cursor->search = true;
+  soapSearchCriteria(&cursor->searchCriteria, &cursor->sortCriteria, searchCriteria1, param1, 
+                     searchCriteria2, param2, sortCriteria);
+
+  return true;
+}
+
+//
+// deliver next page of a paged browse/search, returns false when there are no more pages or on error
+//
+bool SoapESP32::nextPage(soapCursor_t *cursor, soapObjectVect_t *result)
+{
+  return soapNextPage(cursor, result, NULL, NULL);
+}
+
+bool SoapESP32::nextPage(soapCursor_t *cursor, SoapResultSet *result)
+{
+  result->clear(cursor->objectId.c_str());
+  if (!soapNextPage(cursor, NULL, soapResultSetAdd, result)) return false;
+  if (result->full()) {
+    stopPaging(cursor);
+    return false;
+  }
+
+  return true;
+}
+
+//
+// finish paged browse/search early, drops request for next page if already sent
+//
+void SoapESP32::stopPaging(soapCursor_t *cursor)
+{
+  if (m_prefetchPending && cursor->prefetchTag == m_prefetchTag) soapCancelPrefetch();
+  cursor->done = true;
+}
+
+//
+// send request for next page of a paged browse/search
+//
+bool SoapESP32::soapSendPage(soapCursor_t *cursor, bool waitForReply)
+{
+  return soapPost(m_server[cursor->srv].ip, m_server[cursor->srv].port, m_server[cursor->srv].controlURL.c_str(), 
+                  cursor->objectId.c_str(), cursor->search ? cursor->searchCriteria.c_str() : NULL, 
+                  cursor->search ? cursor->sortCriteria.c_str() : NULL, cursor->startingIndex, cursor->pageSize, 
+                  waitForReply);
+}
+
+//
+// drop a prefetched page request, called before the client gets used otherwise
+//
+void SoapESP32::soapCancelPrefetch(void)
+{
+  if (!m_prefetchPending) return;
+
+  claimSPI();
+  m_client->stop();
+  releaseSPI();
+  m_prefetchPending = false;
+  log_d("prefetched page request dropped");
+}
+
+//
+// read reply for current page and send request for following page (if any) right away, so the 
+// server can prepare it while the caller processes the current page
+//
+bool SoapESP32::soapNextPage(soapCursor_t *cursor, soapObjectVect_t *result, soapObjectCallback_t callback, void *arg)
+{
+  soapPageInfo_t page;
+
+  if (cursor->done || cursor->srv >= m_server.size()) return false;
+
+  log_i("%s server: \"%s\", objectId: \"%s\", page: %u, startingIndex: %u", cursor->search ? "search" : "browse", 
+        m_server[cursor->srv].friendlyName.c_str(), cursor->objectId.c_str(), cursor->pages, cursor->startingIndex);
+  bool prefetched = (m_prefetchPending && cursor->prefetchTag == m_prefetchTag);
+  if (prefetched) {
+    m_prefetchPending = false;      // request already sent with previous page
+  }
+  else if (!soapSendPage(cursor, true)) {
+    cursor->done = true;
+    return false;
+  }
+  if (!soapProcessReply(cursor->objectId.c_str(), cursor->search, result, callback, arg, &page)) {
+    // prefetched request might have been sent on a connection the server closed meanwhile
+    if (!prefetched || !soapSendPage(cursor, true) ||
+        !soapProcessReply(cursor->objectId.c_str(), cursor->search, result, callback, arg, &page)) {
+      cursor->done = true;
+      return false;
+    }
+  }
+
+  if (page.totalMatches) cursor->totalMatches = page.totalMatches;
+  if (cursor->pages++ == 0) {
+    cursor->updateId = page.updateId;
+  }
+  else if (page.updateIdValid && page.updateId != cursor->updateId) {
+    log_w("container update id changed from %u to %u while paging", cursor->updateId, page.updateId);
+    cursor->updateIdChanged = true;
+  }
+  cursor->startingIndex += page.numberReturned;
+
+  // decide whether another page is needed, without TotalMatches only a full page asks for more
+  if (page.numberReturned == 0) 
+    cursor->done = true;
+  else if (cursor->totalMatches) 
+    cursor->done = (cursor->startingIndex >= cursor->totalMatches);
+  else 
+    cursor->done = (page.numberReturned < cursor->pageSize);
+
+  if (!cursor->done && soapSendPage(cursor, false)) {
+    cursor->prefetchTag = ++m_prefetchTag;
+    m_prefetchPending = true;
+  }
+
+  return true;
+}
+
+//
+// browse a container without blocking: the request gets sent, poll() evaluates the reply as it
+// comes in. Objects get handed over to callback, done gets called at the end (unless cancelled)
+//
+bool SoapESP32::browseServerAsync(const unsigned int srv,         // server number in list
+                                  const char *objectId,           // directory to browse, "0" represents root according to spec
+                                  soapObjectCallback_t callback,  // called for each object, returns false to stop browsing
+                                  soapDoneCallback_t done,        // called when browsing has finished
+                                  // optional parameter
+                                  void *arg,                      // passed to callbacks
+                                  const uint32_t startingIndex,   // offset into directory content list
+                                  const uint16_t maxCount)        // limits number of objects reported
+{
+  if (callback == NULL || done == NULL || srv >= m_server.size()) return false;
+
+  if (!soapDropAsync()) return false;
+  if (!(m_async = new (std::nothrow) soapAsync_t())) {
+    log_e("no memory for asynchronous request");
+    return false;
+  }
+  log_i("browse server: \"%s\", objectId: \"%s\" (asynchronous)", m_server[srv].friendlyName.c_str(), objectId);
+  m_async->download = false;
+  m_async->search = false;
+  m_async->srv = srv;
+  m_async->objectId = objectId;
+  m_async->startingIndex = startingIndex;
+  m_async->maxCount = maxCount;
+  m_async->done = done;
+  m_async->ready = NULL;
+  m_async->arg = arg;
+  m_async->reply.callback = callback;
+
+  return soapAsyncSend();
+}
+
+//
+// search without blocking, see browseServerAsync()
+//
+bool SoapESP32::searchServerAsync(const unsigned int srv,         // server number in list
+                                  const char *objectId,           // start directory to search from, "0" for root
+                                  soapObjectCallback_t callback,  // called for each object, returns false to stop searching
+                                  soapDoneCallback_t done,        // called when search has finished
+                                  void *arg,                      // passed to callbacks
+                                  const char *searchCriteria1,    // search criteria, e.g. "dc:title contains"
+                                  const char *param1,             // first criteria's parameter, e.g. "word"
+                                  // optional parameter
+                                  const char *searchCriteria2,    // optional search criteria, e.g. "upnp:class derivedfrom"
+                                  const char *param2,             // 2nd criteria's parameter, e.g. "object.item.videoItem"
+                                  const char *sortCriteria,       // optional sort criteria for results returned
+                                  const uint32_t startingIndex,   // offset into content list
+                                  const uint16_t maxCount)        // limits number of objects reported
+{
+  if (callback == NULL || done == NULL || searchCriteria1 == NULL || srv >= m_server.size()) return false;
+
+  if (!soapDropAsync()) return false;
+  if (!(m_async = new (std::nothrow) soapAsync_t())) {
+    log_e("no memory for asynchronous request");
+    return false;
+  }
+  soapSearchCriteria(&m_async->searchCriteria, &m_async->sortCriteria, searchCriteria1, param1, 
+                     searchCriteria2, param2, sortCriteria);
+  log_i("search server: \"%s\", objectId: \"%s\", searchCriteria: %s, sortCriteria: %s (asynchronous)", 
+        m_server[srv].friendlyName.c_str(), objectId, m_async->searchCriteria.c_str(), m_async->sortCriteria.c_str());
+  m_async->download = false;
+  m_async->search = true;
+  m_async->srv = srv;
+  m_async->objectId = objectId;
+  m_async->startingIndex = startingIndex;
+  m_async->maxCount = maxCount;
+  m_async->done = done;
+  m_async->ready = NULL;
+  m_async->arg = arg;
+  m_async->reply.callback = callback;
+
+  return soapAsyncSend();
+}
+
+//
+// request object (file) from media server without blocking, ready gets called by poll() as soon
+// as read() can be used
+//
+bool SoapESP32::readStartAsync(soapObject_t *object, soapReadyCallback_t ready, void *arg)
+{
+  if (object->isDirectory || ready == NULL) return false;
+
+  if (!soapDropAsync()) return false;
+  if (!(m_async = new (std::nothrow) soapAsync_t())) {
+    log_e("no memory for asynchronous request");
+    return false;
+  }
+  log_i("server ip: %s, port: %d, uri: \"%s\" (asynchronous)", 
+        object->downloadIp.toString().c_str(), object->downloadPort, object->uri.c_str());
+  m_async->download = true;
+  m_async->ip = object->downloadIp;
+  m_async->port = object->downloadPort;
+  m_async->uri = object->uri;
+  m_async->objectSize = object->size;
+  m_async->done = NULL;
+  m_async->ready = ready;
+  m_async->arg = arg;
+
+  return soapAsyncSend();
+}
+
+//
+// advance asynchronous request, to be called frequently (e.g. from loop()). Never waits for data, 
+// at most SOAP_RX_BUFFER_SIZE characters get scanned per call. Callbacks get called from here.
+// Event messages get received & subscriptions renewed as well, see subscribeEvents(). Returns true 
+// as long as a request or seeking started by seekServerAsync() is in progress.
+//
+bool SoapESP32::poll(void)
+{
+  soapAsync_t *a;
+  bool idle;
+
+  soapEventPoll();
+  if (m_seek && soapSeekStep(m_seek, &idle)) {
+    soapSeek_t *seek = m_seek;
+    unsigned int found = soapSeekEnd(seek);
+
+    // callback may start seeking again right away
+    m_seek = NULL;
+    soapSeekDoneCallback_t done = seek->done;
+    void *arg = seek->arg;
+    delete seek;
+    done(found, arg);
+  }
+  if (!(a = m_async)) return m_seek != NULL;
+
+  if (a->state == asyncWaitReply) {
+    claimSPI();
+    int av = m_client->available();
+    bool con = av || m_client->connected();
+    releaseSPI();
+    if (av) {
+      // new reply, nothing buffered yet
+      m_rxHead = m_rxTail = 0;
+      m_rxLast = millis();
+      m_conClose = false;
+      a->lineLength = 0;
+      a->firstLine = true;
+      a->state = asyncHeader;
+    }
+    else if (!con && m_conReused && !a->retried) {
+      claimSPI();
+      m_client->stop();
+      releaseSPI();
+      log_d("server closed kept-alive connection, sending request again");
+      a->retried = true;
+      if (!soapAsyncSend()) soapAsyncFinish(false);
+    }
+    else if (!con || millis() - a->start > SERVER_RESPONSE_TIMEOUT) {
+      claimSPI();
+      m_client->stop();
+      releaseSPI();
+      log_e("%s: no reply from server within %d ms", a->download ? "GET" : a->subscribe ? "SUBSCRIBE" : "POST", 
+            SERVER_RESPONSE_TIMEOUT);
+      soapAsyncFinish(false);
+    }
+  }
+  else if (a->state == asyncHeader) {
+    int ret = 1;
+
+    // assemble header lines from data received so far
+    while (ret > 0) {
+      int c = soapClientReadByte(false);
+      if (c == SOAP_WOULD_BLOCK && millis() - m_rxLast <= SERVER_READ_TIMEOUT) break;
+      if (c < 0) {
+        ret = -1;
+        break;
+      }
+      if (c != '\n') {
+        if (a->lineLength < sizeof(a->line) - 1) a->line[a->lineLength++] = c;
+        continue;
+      }
+      if (a->subscribe && !a->firstLine) {
+        a->line[a->lineLength] = 0;
+        soapSubscribeHeaderLine(a->line, &a->replySid, &a->granted);
+      }
+      ret = soapHttpHeaderLine(a->line, a->lineLength, a->firstLine, &a->contentLength, &a->chunked, &a->headerOk);
+      a->firstLine = false;
+      a->lineLength = 0;
+    }
+    if (ret == 0 && !a->subscribe) {
+      soapHttpHeaderEnd(a->headerOk, a->contentLength, &a->chunked);
+      if (!a->headerOk) ret = -1;
+    }
+    if (ret < 0) {
+      log_e("HTTP Header not ok or reply status not 200");
+      claimSPI();
+      m_client->stop();
+      releaseSPI();
+      soapAsyncFinish(false);
+    }
+    else if (ret == 0 && a->subscribe) {
+      // GENA reply has no body of interest
+      claimSPI();
+      m_client->stop();
+      releaseSPI();
+      if (a->replySid.length() == 0) log_e("no subscription id in reply");
+      else statsTime(parsedUs);
+      statsEnd();
+      soapAsyncFinish(a->replySid.length() > 0);
+    }
+    else if (ret == 0 && a->download) {
+      uint64_t size = 0;
+      bool ok = soapDownloadStart(a->contentLength, a->chunked, a->objectSize, &size);
+      soapAsyncFinish(ok, NULL, (size_t)size);
+    }
+    else if (ret == 0 && !a->chunked && a->contentLength == 0) {
+      log_e("announced XML size: 0 !"); 
+      claimSPI();
+      m_client->stop();
+      releaseSPI();    
+      soapAsyncFinish(false);
+    }
+    else if (ret == 0) {
+      log_i("scan answer from media server:"); 
+      soapReplyStart(&a->reply, a->objectId.c_str(), a->search, a->chunked, NULL, a->reply.callback, a->arg);
+      a->state = asyncBody;
+    }
+  }
+  else if (a->state == asyncBody) {
+    int ret = soapReplyParse(&a->reply, false);
+    if (ret == replyBusy && millis() - m_rxLast > SERVER_READ_TIMEOUT) {
+      log_e("read timeout, %d ms without data", SERVER_READ_TIMEOUT);
+      a->reply.reusable = false;
+      ret = a->reply.gotCount ? replyDone : replyStopped;
+    }
+    if (ret != replyBusy) {
+      soapPageInfo_t info = { 0, 0, 0, false };
+      soapReplyEnd(&a->reply, ret == replyDone, &info);
+      soapAsyncFinish(true, (ret == replyDone) ? &info : NULL);
+    }
+  }
+#ifndef USE_ETHERNET
+  else if (a->state == asyncConnect) {
+    int ret = soapAsyncConnect();
+    if (ret > 0) {
+      a->connected = true;
+      if (!soapAsyncSend()) soapAsyncFinish(false);
+    }
+    else if (ret < 0) {
+      soapAsyncFinish(false);
+    }
+  }
+#endif
+
+  return (m_async != NULL && !m_async->subscribe) || m_seek != NULL;
+}
+
+//
+// set server receiving event messages (GENA NOTIFY) for subscribeEvents(), port must be the one the 
+// server listens to. Callback is optional, cached results get dropped anyway. Replacing the listener 
+// by another one or removing it (server NULL) cancels all event subscriptions
+//
+#ifdef USE_ETHERNET
+bool SoapESP32::setEventListener(EthernetServer *server, uint16_t port, soapEventCallback_t callback, void *arg)
+#else
+bool SoapESP32::setEventListener(WiFiServer *server, uint16_t port, soapEventCallback_t callback, void *arg)
+#endif
+{
+  if (server && !port) return false;
+
+  if (m_eventServer && (server != m_eventServer || port != m_eventPort)) {
+    // server would send event messages to a listener that's gone
+    soapEventDrop();
+    soapUnsubscribeAll();
+    m_eventServer = NULL;
+  }
+  if (!server) return true;
+
+  claimSPI();
+  server->begin();
+  releaseSPI();
+  m_eventServer = server;
+  m_eventPort = port;
+  m_eventCallback = callback;
+  m_eventArg = arg;
+
+  return true;
+}
+
+//
+// subscribe to ContentDirectory events of a server, e.g. to learn about changed containers without
+// browsing them again. Needs setEventListener() first, events get received and subscriptions
+// renewed by poll(), so it must be called frequently
+//
+bool SoapESP32::subscribeEvents(const unsigned int srv, uint32_t timeout)
+{
+  soapSubscription_t *sub = NULL;
+
+  if (srv >= m_server.size()) {
+    log_e("invalid server number: %d", srv);
+    return false;
+  }
+  if (!m_eventServer) {
+    log_e("no event listener, see setEventListener()");
+    return false;
+  }
+  if (m_server[srv].eventURL.length() == 0) {
+    log_e("server \"%s\" doesn't offer events", m_server[srv].friendlyName.c_str());
     return false;
+  }
+
+  for (soapSubscription_t &s : m_subscriptions) {
+    if (s.ip == m_server[srv].ip && s.port == m_server[srv].port) sub = &s;
+  }
+  if (!sub) {
+    m_subscriptions.push_back({ .ip = m_server[srv].ip, .port = m_server[srv].port, .eventURL = m_server[srv].eventURL,
+                                .sid = "", .timeout = 0, .renewAt = 0, .seq = 0 });
+    sub = &m_subscriptions.back();
+  }
+  sub->timeout = timeout ? timeout : GENA_SUBSCRIPTION_TIMEOUT;
+
+  // already subscribed: renew with new timeout
+  if (sub->sid.length() && soapSubscribe(sub, true)) return true;
+  sub->sid = "";
+  if (soapSubscribe(sub, false)) return true;
+
+  m_subscriptions.erase(m_subscriptions.begin() + (sub - &m_subscriptions[0]));
+  return false;
+}
+
+//
+// cancel event subscription of a server
+//
+bool SoapESP32::unsubscribeEvents(const unsigned int srv)
+{
+  if (srv >= m_server.size()) return false;
+
+  for (size_t i = 0; i < m_subscriptions.size(); i++) {
+    if (m_subscriptions[i].ip != m_server[srv].ip || m_subscriptions[i].port != m_server[srv].port) continue;
+    bool ok = soapUnsubscribe(&m_subscriptions[i]);
+    m_subscriptions.erase(m_subscriptions.begin() + i);
+    return ok;
+  }
+
+  return false;
+}
+
+//
+// helper function, send UNSUBSCRIBE request for a subscription (if still alive) & evaluate reply
+//
+bool SoapESP32::soapUnsubscribe(soapSubscription_t *sub)
+{
+  const char *slot[slotTotal] = { NULL };
+  bool ok = (sub->sid.length() == 0);
+
+  if (!ok) {
+    slot[slotUri] = sub->eventURL.c_str();
+    slot[slotSid] = sub->sid.c_str();
+    log_d("%s:%d UNSUBSCRIBE /%s %s", sub->ip.toString().c_str(), sub->port, slot[slotUri], HTTP_VERSION);
+    if (soapSendRequest(sub->ip, sub->port, reqUnsubscribe, slot, true)) {
+      char line[TMP_BUFFER_SIZE_200];
+      int status = 0;
+
+      // only status line is of interest
+      m_rxHead = m_rxTail = 0;
+      size_t len = soapClientReadLine(line, sizeof(line) - 1);
+      line[len] = 0;
+      claimSPI();
+      m_client->stop();
+      releaseSPI();
+      statsTime(parsedUs);
+      statsEnd();
+      ok = (sscanf(line, "HTTP/%*u.%*u %d", &status) == 1 && status == 200);
+    }
+  }
+  log_i("event subscription of server %s:%d cancelled", sub->ip.toString().c_str(), sub->port);
+
+  return ok;
+}
+
+//
+// helper function, cancel all event subscriptions
+//
+void SoapESP32::soapUnsubscribeAll(void)
+{
+  for (soapSubscription_t &sub : m_subscriptions) soapUnsubscribe(&sub);
+  m_subscriptions.clear();
+}
+
+//
+// helper function, send SUBSCRIBE request, renews subscription sid unless it's NULL
+//
+bool SoapESP32::soapSubscribeSend(const IPAddress ip, const uint16_t port, const char *eventURL, const char *sid,
+                                  uint32_t timeout, bool waitForReply)
+{
+  const char *slot[slotTotal] = { NULL };
+  char callback[60], duration[12];
+
+#ifdef USE_ETHERNET
+  IPAddress local = Ethernet.localIP();
 #else
-    log_w("scanned parent id \"%s\" != requested parent id \"%s\"", str.c_str(), parentId->c_str());
+  IPAddress local = WiFi.localIP();
 #endif
+  snprintf(callback, sizeof(callback), "http://%s:%u/" GENA_CALLBACK_PATH, local.toString().c_str(), m_eventPort);
+  snprintf(duration, sizeof(duration), "%u", timeout);
+  slot[slotUri] = eventURL;
+  slot[slotCallback] = callback;
+  slot[slotSid] = sid;
+  slot[slotTimeout] = duration;
+  log_d("%s:%d SUBSCRIBE /%s %s", ip.toString().c_str(), port, eventURL, HTTP_VERSION);
+
+  return soapSendRequest(ip, port, sid ? reqRenew : reqSubscribe, slot, waitForReply);
+}
+
+//
+// helper function, send SUBSCRIBE request (new subscription or renewal) & evaluate reply
+//
+bool SoapESP32::soapSubscribe(soapSubscription_t *sub, bool renew)
+{
+  char line[TMP_BUFFER_SIZE_200];
+  int status = 0;
+  uint32_t granted = 0;
+  String sid((char *)0);
+
+  if (!soapSubscribeSend(sub->ip, sub->port, sub->eventURL.c_str(), renew ? sub->sid.c_str() : NULL, 
+                         sub->timeout, true)) {
+    return false;
   }
 
-  info.parentId = *parentId; 
-  info.fileType = fileTypeOther;
-  info.album = "";
-  info.artist = "";
-  info.genre = "";
-  info.bitrate = 0;
-  info.sampleFrequency = 0;
-  info.size = 0;
-  info.sizeMissing = false;
+  // status line, then header lines with subscription id & granted duration
+  m_rxHead = m_rxTail = 0;
+  size_t len = soapClientReadLine(line, sizeof(line) - 1);
+  line[len] = 0;
+  if (sscanf(line, "HTTP/%*u.%*u %d", &status) != 1 || status != 200) {
+    log_e("%s failed, reply: %s", renew ? "renewal" : "subscription", line);
+    goto end_stop;
+  }
+  while ((len = soapClientReadLine(line, sizeof(line) - 1)) > 1) {
+    line[len] = 0;
+    soapSubscribeHeaderLine(line, &sid, &granted);
+  }
+  if (sid.length() == 0) {
+    log_e("no subscription id in reply");
+    status = 0;
+  }
 
-  // scan for uri, size, album (sometimes dir name when picture file) and title, artist (when audio file)
-  MiniXPath xPathTitle, xPathAlbum, xPathArtist, xPathGenre, xPathClass, xPathRes;
-  String strAttr((char *)0);
-  bool gotTitle = false, gotAlbum = false, gotArtist = false, gotGenre = false, gotClass = false, gotRes = false;
-
-  xPathTitle.setPath(&xmlParserPaths[xpTitle]);
-  xPathAlbum.setPath(&xmlParserPaths[xpAlbum]);
-  xPathArtist.setPath(&xmlParserPaths[xpArtist]);
-  xPathGenre.setPath(&xmlParserPaths[xpGenre]);
-  xPathClass.setPath(&xmlParserPaths[xpClass]);
-  xPathRes.setPath(&xmlParserPaths[xpResource]);
-  while (i < item->length()) {
-    if (!gotTitle && xPathTitle.getValue((char)item->operator[](i), &str)) {
-      if (str.length() == 0) return false;    // valid title is a must 
-      info.name = str;
-      log_d("%s=\"%s\"", xmlParserPaths[xpTitle].tagNames[0], str.c_str());
-      gotTitle = true;
-    }
-    if (!gotAlbum && xPathAlbum.getValue((char)item->operator[](i), &str)) {
-      info.album = str;                       // missing album not a showstopper
-      log_d("%s=\"%s\"", xmlParserPaths[xpAlbum].tagNames[0], str.c_str());;
-      gotAlbum = true;
-    }
-    if (!gotArtist && xPathArtist.getValue((char)item->operator[](i), &str)) {
-      info.artist = str;                      // missing artist not a showstopper
-      log_d("%s=\"%s\"", xmlParserPaths[xpArtist].tagNames[0], str.c_str());
-      gotArtist = true;
-    }
-    if (!gotGenre && xPathGenre.getValue((char)item->operator[](i), &str)) {
-      info.genre = str;                       // missing genre not a showstopper
-      log_d("%s=\"%s\"", xmlParserPaths[xpGenre].tagNames[0], str.c_str());
-      gotGenre = true;
-    }
-    if (!gotClass && xPathClass.getValue((char)item->operator[](i), &str)) {
-      log_d("%s=\"%s\"", xmlParserPaths[xpClass].tagNames[0], str.c_str());
-      if (str.indexOf("audioItem") >= 0) 
-        info.fileType = fileTypeAudio;
-      else if (str.indexOf("imageItem") >= 0) 
-        info.fileType = fileTypeImage;
-      else if (str.indexOf("videoItem")) 
-        info.fileType = fileTypeVideo;
-      else 
-        info.fileType = fileTypeOther;
-      gotClass = true;
-    }
-    if (!gotRes && xPathRes.getValue((char)item->operator[](i), &str, &strAttr)) {
-      if (str.startsWith("http://")) {
-        // scan for download ip & port
-        if (sscanf(str.c_str(), "http://%[0-9.]:%d/", address, &port) != 2) return false;
-        info.downloadPort = (uint16_t)port;
-        if (!ip.fromString(address)) return false;
-        info.downloadIp = ip;
-        // remove "http://ip:port/" from begin of string
-        str.replace("http://", "");        
-        info.uri = str.substring(str.indexOf("/") + 1); 
+end_stop:
+  claimSPI();
+  m_client->stop();
+  releaseSPI();
+  if (status == 200) statsTime(parsedUs);
+  statsEnd();
+  if (status != 200) return false;
+
+  soapSubscribeApply(sub, renew, &sid, granted);
+  return true;
+}
+
+//
+// helper function, SUBSCRIBE request succeeded: take over subscription id & schedule renewal
+//
+void SoapESP32::soapSubscribeApply(soapSubscription_t *sub, bool renew, const String *sid, uint32_t granted)
+{
+  if (!renew) {
+    sub->sid = *sid;
+    sub->seq = 0;
+  }
+  if (granted == 0) granted = sub->timeout;
+  sub->renewAt = millis() + ((granted > 2 * GENA_RENEW_MARGIN) ? granted - GENA_RENEW_MARGIN : granted / 2) * 1000;
+  log_i("%s %s, granted %u s", renew ? "renewed" : "subscribed", sub->sid.c_str(), granted);
+}
+
+//
+// helper function, SUBSCRIBE request of soapEventPoll() failed. A renewal fails as well if the 
+// subscription got lost, e.g. when server restarted: subscribe again right away
+//
+void SoapESP32::soapSubscribeFailed(soapSubscription_t *sub, bool renew)
+{
+  if (renew) {
+    sub->sid = "";
+    return;
+  }
+  log_w("event subscription of server %s:%d failed, next try in %d ms", 
+        sub->ip.toString().c_str(), sub->port, GENA_RETRY_INTERVAL);
+  sub->renewAt = millis() + GENA_RETRY_INTERVAL;
+}
+
+//
+// helper function, renew a subscription (or subscribe again) without blocking: sent as asynchronous
+// request, its reply gets evaluated by poll() like that of browseServerAsync()
+//
+void SoapESP32::soapSubscribeAsync(soapSubscription_t *sub)
+{
+  bool renew = sub->sid.length() > 0;
+
+  if (!(m_async = new (std::nothrow) soapAsync_t())) {
+    log_e("no memory for asynchronous request");
+    return;
+  }
+  m_async->download = false;
+  m_async->subscribe = true;
+  m_async->ip = sub->ip;
+  m_async->port = sub->port;
+  m_async->uri = sub->eventURL;
+  m_async->sid = sub->sid;
+  m_async->timeout = sub->timeout;
+  m_async->done = NULL;
+  m_async->ready = NULL;
+  m_async->arg = NULL;
+  if (soapAsyncSend()) return;
+  if (m_async) soapAsyncFinish(false);
+  else soapSubscribeFailed(sub, renew);
+}
+
+//
+// helper function, called by poll(): receive event messages & renew subscriptions when due. Never
+// waits for data
+//
+void SoapESP32::soapEventPoll(void)
+{
+  if (!m_eventServer) return;
+
+  // a single event message at a time
+  if (!m_eventRx) {
+    claimSPI();
+#ifdef USE_ETHERNET
+    EthernetClient client = m_eventServer->available();
+#else
+    WiFiClient client = m_eventServer->available();
+#endif
+    releaseSPI();
+    if (client) {
+      if ((m_eventRx = new (std::nothrow) soapEventRx_t())) {
+        m_eventRx->client = client;
+        m_eventRx->start = millis();
+        m_eventRx->xPathEvent.addPath(&xmlParserPaths[xpEventSystemUpdateId]);
+        m_eventRx->xPathEvent.addPath(&xmlParserPaths[xpEventContainerUpdateIds]);
       }
       else {
-        info.uri = str;
+        log_e("no memory for event message");
+        claimSPI();
+        client.stop();
+        releaseSPI();
       }
-      if (info.uri.length() == 0) return false;   // valid URI is a must     
-      log_d("uri=\"%s\"", info.uri.c_str());
+    }
+  }
+  if (m_eventRx) soapEventReceive();
+
+  // renewal would drop a request in progress
+  if (m_async || m_clientDataConOpen || m_prefetchPending) return;
+  for (soapSubscription_t &sub : m_subscriptions) {
+    if ((int32_t)(millis() - sub.renewAt) < 0) continue;
+    soapSubscribeAsync(&sub);
+    break;                          // a single request at a time
+  }
+}
 
-      // scan item size
-      if (!soapScanAttribute(&strAttr, &str, DIDL_ATTR_SIZE)) {
-        // indicates missing attribute "size" (e.g. Kodi audio files, Fritzbox/Serviio stream items)
-        info.sizeMissing = true;
-      } 
-      else {
-        info.size = strtoull(str.c_str(), NULL, 10);
-        log_d("size=%llu", info.size);
+//
+// helper function, receive event message (GENA NOTIFY) in progress as far as data has arrived, 
+// at most SOAP_RX_BUFFER_SIZE bytes per call. Once complete it gets answered & evaluated
+//
+void SoapESP32::soapEventReceive(void)
+{
+  soapEventRx_t *rx = m_eventRx;
+  const char *reply = NULL;
+
+  for (size_t budget = SOAP_RX_BUFFER_SIZE; budget > 0 && !reply; budget--) {
+    if (rx->head >= rx->tail) {
+      claimSPI();
+      int len = rx->client.read(rx->buffer, sizeof(rx->buffer));
+      bool con = (len > 0) || rx->client.connected();
+      releaseSPI();
+      if (len <= 0) {
+        if (con && millis() - rx->start <= GENA_NOTIFY_TIMEOUT) return;    // more to come
+        log_w("event message incomplete%s", con ? " (timeout)" : "");
+        reply = "400 Bad Request";
+        break;
       }
-#if !defined(SHOW_EMPTY_FILES)
-      if (info.size == 0 && !info.sizeMissing) {        
-        log_w("reported size=0, item ignored"); 
-        return false;
+      rx->head = 0;
+      rx->tail = len;
+    }
+    int c = rx->buffer[rx->head++];
+
+    if (rx->state == eventBody) {
+      // scan property set
+      int match = rx->xPathEvent.getValue((char)c, &rx->str);
+      if (match == xeSystemUpdateId) {
+        rx->event.systemUpdateId = strtoul(rx->str.c_str(), NULL, 10);
+        rx->event.systemUpdateIdValid = true;
       }
-#endif        
+      else if (match == xeContainerUpdateIds) {
+        // comma separated pairs of container id & update id
+        int from = 0, comma, next;
+        while ((comma = rx->str.indexOf(',', from)) > from) {
+          soapContainerUpdate_t update;
+          if ((next = rx->str.indexOf(',', comma + 1)) < 0) next = rx->str.length();
+          update.id = rx->str.substring(from, comma);
+          update.updateId = strtoul(rx->str.c_str() + comma + 1, NULL, 10);
+          rx->event.containers.push_back(update);
+          from = next + 1;
+        }
+      }
+      if (--rx->contentLength == 0) reply = "200 OK";
+    }
+    else if (c == '\n') {
+      rx->line[rx->lineLength] = 0;
+      reply = soapEventHeaderLine(rx);
+      rx->lineLength = 0;
+    }
+    else if (c != '\r' && rx->lineLength < sizeof(rx->line) - 1) {
+      rx->line[rx->lineLength++] = (char)c;
+    }
+  }
+  if (!reply) return;
 
-      // scan bitrate (often provided when audio file)
-      if (soapScanAttribute(&strAttr, &str, DIDL_ATTR_BITRATE)) {
-        info.bitrate = (size_t)str.toInt();
-        if (info.bitrate == 0) {
-          log_w("bitrate=0 !"); 
-        }              
-        else { 
-          log_d("bitrate=%d", info.bitrate);
-        }  
-      }  
+  claimSPI();
+  rx->client.printf(HTTP_VERSION " %s\r\nContent-Length: 0\r\n" HEADER_CONNECTION_CLOSE HEADER_EMPTY_LINE, reply);
+  rx->client.stop();
+  releaseSPI();
+  m_eventRx = NULL;
 
-      // scan sample frequency (often provided when audio file)
-      if (soapScanAttribute(&strAttr, &str, DIDL_ATTR_SAMPLEFREQU)) {
-        info.sampleFrequency = (size_t)str.toInt();
-        if (info.sampleFrequency == 0) {
-          log_w("sampleFrequency=0");   
-        }            
-        else { 
-          log_d("sampleFrequency=%d", info.sampleFrequency);
-        }  
-      }  
-#if !defined(NO_PROTOCOL_INFO)
-      // info about media format, gets important when extension e.g. ".mp3" is missing in id and url
-      if (soapScanAttribute(&strAttr, &str, DIDL_ATTR_PROT_INFO)) {
-        info.protInfo = str;
-        if (info.protInfo.length() == 0) {
-          log_w("protocolInfo=\"\" (undefined)");   
-        }            
-        else { 
-          log_d("protocolInfo=\"%s\"", info.protInfo.c_str());
-        }  
-      }  
+  soapSubscription_t *sub = NULL;
+  for (soapSubscription_t &s : m_subscriptions) {
+    if (s.sid.length() && s.sid == rx->sid) sub = &s;
+  }
+  if (reply[0] == '2' && sub) {
+    log_i("event from server %s:%d, SEQ %u, SystemUpdateID %s%u, %d containers changed", sub->ip.toString().c_str(), 
+          sub->port, rx->seq, rx->event.systemUpdateIdValid ? "" : "(none) ", rx->event.systemUpdateId, 
+          rx->event.containers.size());
+    rx->event.seq = rx->seq;
+    bool missed = (rx->seq != sub->seq);
+    sub->seq = (rx->seq == UINT32_MAX) ? 1 : rx->seq + 1;   // event key wraps to 1
+    soapEventApply(sub, &rx->event, missed);
+  }
+  delete rx;
+}
+
+//
+// helper function, evaluate a line of an event message header (without "\r\n"). Returns the reply 
+// if the message gets rejected, NULL otherwise
+//
+const char *SoapESP32::soapEventHeaderLine(soapEventRx_t *rx)
+{
+  char *p;
+
+  if (rx->state == eventRequestLine) {
+    if (strncmp(rx->line, GENA_NOTIFY, strlen(GENA_NOTIFY)) != 0) {
+      log_w("unexpected request on event listener: %s", rx->line);
+      return "400 Bad Request";
+    }
+    rx->state = eventHeader;
+  }
+  else if (rx->lineLength > 0) {
+    if (strncasecmp(rx->line, HEADER_SID, strlen(HEADER_SID)) == 0) {
+      rx->sid = rx->line + strlen(HEADER_SID);
+      rx->sid.trim();
+    }
+    else if (strncasecmp(rx->line, HEADER_SEQ, strlen(HEADER_SEQ)) == 0) {
+      rx->seq = strtoul(rx->line + strlen(HEADER_SEQ), NULL, 10);
+    }
+    else if ((p = strcasestr(rx->line, HEADER_CONTENT_LENGTH)) != NULL) {
+      sscanf(p + strlen(HEADER_CONTENT_LENGTH), "%llu", &rx->contentLength);
+    }
+  }
+  else {
+    // end of header
+    bool known = false;
+    for (soapSubscription_t &s : m_subscriptions) {
+      if (s.sid.length() && s.sid == rx->sid) known = true;
+    }
+    if (rx->contentLength == 0) {
+      log_w("event message without content length");
+      return "400 Bad Request";
+    }
+    if (!known) {
+      log_w("event message with unknown SID: %s", rx->sid.c_str());
+      return "412 Precondition Failed";
+    }
+    rx->state = eventBody;
+  }
+
+  return NULL;
+}
+
+//
+// helper function, drop event message being received
+//
+void SoapESP32::soapEventDrop(void)
+{
+  if (!m_eventRx) return;
+  claimSPI();
+  m_eventRx->client.stop();
+  releaseSPI();
+  delete m_eventRx;
+  m_eventRx = NULL;
+}
+
+//
+// helper function, drop cached results outdated by an event & hand event over to application
+//  - listed containers: results with a different update id get dropped
+//  - changed SystemUpdateID or missed events: all search results as well (they span sub containers), 
+//    without container list all results of server
+//
+void SoapESP32::soapEventApply(soapSubscription_t *sub, soapEvent_t *event, bool missed)
+{
+  bool changed = missed;
+  unsigned int dropped = 0;
+
+  if (missed) log_w("event(s) missed, SEQ %u", event->seq);
+  if (event->systemUpdateIdValid && soapSystemUpdateIdChanged(sub->ip, sub->port, event->systemUpdateId)) changed = true;
+
+  for (size_t i = 0; i < m_cache.size(); ) {
+    soapCacheEntry_t *entry = m_cache[i];
+    bool drop = false;
+    if (entry->ip == sub->ip && entry->port == sub->port) {
+      drop = changed && (entry->search || event->containers.empty());
+      for (size_t j = 0; !drop && j < event->containers.size(); j++) {
+        if (entry->objectId == event->containers[j].id) {
+          drop = !entry->page.updateIdValid || entry->page.updateId != event->containers[j].updateId;
+          break;
+        }
+      }
+    }
+    if (drop) {
+      soapCacheErase(i);
+      dropped++;
+      continue;
+    }
+    i++;
+  }
+  if (dropped) log_d("%d cached results dropped", dropped);
+  m_cacheStats.invalidated += dropped;
+
+  if (!m_eventCallback) return;
+  for (unsigned int srv = 0; srv < m_server.size(); srv++) {
+    if (m_server[srv].ip == sub->ip && m_server[srv].port == sub->port) {
+      event->srv = srv;
+      m_eventCallback(event, m_eventArg);
+      break;
+    }
+  }
+}
+
+//
+// drop asynchronous request in progress, its done/ready callback doesn't get called
+//
+void SoapESP32::cancelRequest(void)
+{
+  soapCancelAsync(false);
+}
+
+//
+// helper function, send request of asynchronous browse/search/download, reply gets evaluated by poll()
+//
+bool SoapESP32::soapAsyncSend(void)
+{
+  soapAsync_t *a = m_async;
+  IPAddress ip = (a->download || a->subscribe) ? a->ip : m_server[a->srv].ip;
+  uint16_t port = (a->download || a->subscribe) ? a->port : m_server[a->srv].port;
+  bool ok;
+
+#ifndef USE_ETHERNET
+  if (!a->connected && !(m_conIdle && ip == m_conIp && port == m_conPort && 
+                         m_client->connected() && !m_client->available())) {
+    // no kept-alive connection to reuse: poll() connects first & sends the request when done
+    a->state = asyncConnect;
+    a->attempts = 0;
+    a->fd = -1;
+    return true;
+  }
+#endif
+  a->state = asyncSend;             // keeps soapSendRequest() from dropping us
+  if (a->download) {
+    ok = soapGet(ip, port, a->uri.c_str(), false);
+  }
+  else if (a->subscribe) {
+    ok = soapSubscribeSend(ip, port, a->uri.c_str(), a->sid.length() ? a->sid.c_str() : NULL, a->timeout, false);
+  }
+  else {
+    ok = soapPost(ip, port, m_server[a->srv].controlURL.c_str(), 
+                  a->objectId.c_str(), a->search ? a->searchCriteria.c_str() : NULL, 
+                  a->search ? a->sortCriteria.c_str() : NULL, a->startingIndex, a->maxCount, false);
+  }
+  a->state = asyncWaitReply;
+  a->start = millis();
+  if (!ok && !a->retried && !a->connected) {
+    // nothing sent, no callback
+    delete a;
+    m_async = NULL;
+  }
+
+  return ok;
+}
+
+#ifndef USE_ETHERNET
+//
+// helper function, connect to server of asynchronous request without waiting: a non-blocking socket
+// gets connected here and taken over by the client in soapConnect(). Like there up to 3 attempts are 
+// made, 100 ms apart. Returns 1 when connected, 0 while still connecting, -1 if all attempts failed
+//
+int SoapESP32::soapAsyncConnect(void)
+{
+  soapAsync_t *a = m_async;
+  IPAddress ip = (a->download || a->subscribe) ? a->ip : m_server[a->srv].ip;
+  uint16_t port = (a->download || a->subscribe) ? a->port : m_server[a->srv].port;
+  bool failed = false;
+
+  if (a->fd < 0) {
+    struct sockaddr_in addr;
+
+    if (a->attempts && millis() - a->start < 100) return 0;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = (uint32_t)ip;
+    a->attempts++;
+    a->start = millis();
+    a->fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    failed = (a->fd < 0 || fcntl(a->fd, F_SETFL, fcntl(a->fd, F_GETFL, 0) | O_NONBLOCK) < 0 ||
+              (connect(a->fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 && errno != EINPROGRESS));
+  }
+  if (!failed) {
+    // connection established (or refused) as soon as socket is writable
+    fd_set fdset;
+    struct timeval tv = { 0, 0 };
+    int err = 0;
+    socklen_t len = sizeof(err);
+
+    FD_ZERO(&fdset);
+    FD_SET(a->fd, &fdset);
+    int ret = select(a->fd + 1, NULL, &fdset, NULL, &tv);
+    if (ret == 0 && millis() - a->start <= SERVER_RESPONSE_TIMEOUT) return 0;
+    if (ret > 0 && getsockopt(a->fd, SOL_SOCKET, SO_ERROR, &err, &len) == 0 && err == 0) {
+      log_d("connected to server ip=%s, port=%d", ip.toString().c_str(), port);
+      return 1;
+    }
+  }
+  if (a->fd >= 0) close(a->fd);
+  a->fd = -1;
+  a->start = millis();
+  if (a->attempts < 3) return 0;
+  log_e("error connecting to server ip=%s, port=%d", ip.toString().c_str(), port);
+
+  return -1;
+}
 #endif
-      gotRes = true;
+
+//
+// helper function, asynchronous request has finished: report result
+//
+void SoapESP32::soapAsyncFinish(bool ok, const soapPageInfo_t *page, size_t size)
+{
+  soapAsync_t *a = m_async;
+  soapPageInfo_t info;
+
+  if (!a) return;
+  if (a->subscribe) {
+    // SUBSCRIBE of soapEventPoll()
+    for (soapSubscription_t &sub : m_subscriptions) {
+      if (sub.ip != a->ip || sub.port != a->port) continue;
+      if (ok) soapSubscribeApply(&sub, a->sid.length() > 0, &a->replySid, a->granted);
+      else soapSubscribeFailed(&sub, a->sid.length() > 0);
     }
-    i++;
+    delete a;
+    m_async = NULL;
+    return;
   }
+  if (page) info = *page;
+  soapDoneCallback_t done = a->done;
+  soapReadyCallback_t ready = a->ready;
+  void *arg = a->arg;
+
+  // callbacks may start a new request right away
+  delete a;
+  m_async = NULL;
+  if (ready) ready(ok, size, arg);
+  else done(ok, page ? &info : NULL, arg);
+}
 
-  if (!gotTitle || !gotRes) {
-    log_i("title or ressource info missing, file not added to list");
-    return false;   // title & ressource info is a must
-  }  
+//
+// helper function, drop asynchronous request in progress. If report is set its done/ready callback 
+// gets called (with false). Renewing an event subscription doesn't report, it's simply retried later
+//
+void SoapESP32::soapCancelAsync(bool report)
+{
+  if (!m_async || m_async->state == asyncSend) return;
 
-  // add valid file to result list
-  info.isDirectory = false;
-  browseResult->push_back(info);
+#ifndef USE_ETHERNET
+  if (m_async->state == asyncConnect && m_async->fd >= 0) close(m_async->fd);
+  m_async->fd = -1;
+#endif
+  claimSPI();
+  m_client->stop();
+  releaseSPI();
+  log_d("asynchronous request dropped");
+  if (report && !m_async->subscribe) {
+    soapAsyncFinish(false);
+    return;
+  }
+  delete m_async;
+  m_async = NULL;
+}
 
-  log_i("\"%s\" (id: \"%s\", size: %llu, sizeMissing: %s, type: %s) added to list", 
-        info.name.c_str(), info.id.c_str(), info.size, info.sizeMissing ? "true" : "false", getFileTypeName(info.fileType));
-  // TEST
-#if CORE_DEBUG_LEVEL >= 4  
-  delay(3);
-#elif CORE_DEBUG_LEVEL >= 2
-  delay(1);
-#endif 
+//
+// helper function, make way for a new request: asynchronous request in progress gets dropped & 
+// reported as failed. Returns false if its callback started another request right away, that one 
+// is kept
+//
+bool SoapESP32::soapDropAsync(void)
+{
+  soapCancelAsync(true);
+  if (!m_async || m_async->state == asyncSend) return true;
+  log_w("callback of dropped request started another one");
 
-  return true;
+  return false;
 }
 
 //
-// Process browse and search requests
+// querying a media server's search/sort capabilities
 //
-bool SoapESP32::soapProcessRequest(const unsigned int srv,         // server number in list
-                                   const char *objectId,           // directory to search, "0" represents root according to spec
-                                   soapObjectVect_t *result,       // where to store browse/search results
-                                   const char *searchCriteria,     // what to search for, e.g. "upnp:artist contains \"Name\""
-                                   const char *sortCriteria,       // sort criteria for results returned
-                                   const uint32_t startingIndex,   // offset into content list
-                                   const uint16_t maxCount)        // limits number of objects in result list
+bool SoapESP32::getServerCapabilities(const unsigned int srv, eCapabilityType capability, soapServerCapVect_t *result)
 {
   if (srv >= m_server.size()) {
     log_e("invalid server number: %d", srv);
     return false;
   }
 
-  bool search = (searchCriteria != NULL);
-  if (search)
-    log_i("search server: \"%s\", objectId: \"%s\", searchCriteria: %s, sortCriteria: %s", 
-           m_server[srv].friendlyName.c_str(), objectId, searchCriteria, sortCriteria);
-  else 
-    log_i("browse server: \"%s\", objectId: \"%s\"", m_server[srv].friendlyName.c_str(), objectId);
-
-  if (startingIndex != (search ? SOAP_DEFAULT_SEARCH_STARTING_INDEX : SOAP_DEFAULT_BROWSE_STARTING_INDEX)) 
-    log_d("special parameter for \"startingIndex\": %d", startingIndex);
-  if (maxCount != (search ? SOAP_DEFAULT_SEARCH_MAX_COUNT : SOAP_DEFAULT_BROWSE_MAX_COUNT)) 
-    log_d("special parameter for \"maxCount\": %d", maxCount);
-
-  // send SOAP browse/search request to server
-  if (!soapPost(m_server[srv].ip, m_server[srv].port, m_server[srv].controlURL.c_str(), objectId,
-                searchCriteria, sortCriteria, startingIndex, maxCount)) {
-    return false;
-  }  
-  log_i("connected successfully to server %s:%d", m_server[srv].ip.toString().c_str(), m_server[srv].port);
+  log_i("querying %s capabilities from server: \"%s\"", (capability == capSearch) ? "search" : "sort", m_server[srv].friendlyName.c_str());
 
-  // evaluate SOAP answer
-  uint64_t contentSize;
-  bool chunked = false;
-  int count = 0, countContainer = 0, countItem = 0;
-  MiniXPath xPathContainer, xPathContainerAlt,
-            xPathItem, xPathItemAlt,
-            xPathNumberReturned, xPathNumberReturnedAlt;
-  String str((char *)0), strAttribute((char *)0);
+  String strCaps((char *)0);
 
-  // reading HTTP header
-  if (!soapReadHttpHeader(&contentSize, &chunked)) {
-    log_e("HTTP Header not ok or reply status not 200");
-    claimSPI();
-    m_client->stop();
-    releaseSPI();
+  if (!soapQueryValue(srv, (capability == capSort) ? reqGetSortCap : reqGetSearchCap,
+                      (capability == capSearch) ? xpGetSearchCapabilities : xpGetSortCapabilities, &strCaps)) {
     return false;
   }
-  if (!chunked && contentSize == 0) {  
-    log_e("announced XML size: 0 !"); 
-    claimSPI();
-    m_client->stop();
-    releaseSPI();    
-    return false;
-  } 
-  log_i("scan answer from media server:"); 
 
-  // time to clean result list
   result->clear();
+  if (strCaps.length()) {
+    unsigned int start = 0;
+    int index;
+    String strItem((char *)0);
 
-  // HTTP header ok, now scan XML/SOAP reply
-  String objId = objectId;  
-  int eNum = search ? xpSearchContainer : xpBrowseContainer;
-  xPathContainer.setPath(&xmlParserPaths[eNum++]);
-  xPathContainerAlt.setPath(&xmlParserPaths[eNum++]);
-  xPathItem.setPath(&xmlParserPaths[eNum++]);
-  xPathItemAlt.setPath(&xmlParserPaths[eNum++]);
-  xPathNumberReturned.setPath(&xmlParserPaths[eNum++]);
-  xPathNumberReturnedAlt.setPath(&xmlParserPaths[eNum]);
-  while (true) {
-    int ret = soapReadXML(chunked, true);  // de-chunk data stream and replace XML-entities (if found)
-    if (ret < 0) {
-      log_e("soapReadXML() returned: %d%s", ret, ret == -1 ? " (likely EOF)" : ""); 
-      goto end_stop;
-    }  
-    // TEST
-    //Serial.print((char)ret);
-    //
-    // only one will return a result
-    if (xPathContainer.getValue((char)ret, &str, &strAttribute, true) ||
-        xPathContainerAlt.getValue((char)ret, &str, &strAttribute, true)) {
-#if CORE_DEBUG_LEVEL == 5
-      log_v("container attribute (length=%d): %s", strAttribute.length(), strAttribute.c_str());
-      log_v("container (length=%d): %s", str.length(), str.c_str());
-      delay(1); // also resets task switcher watchdog
-#endif
-      if (soapScanContainer(&objId, &strAttribute, &str, result))
-        countContainer++;
-    }
-    if (xPathItem.getValue((char)ret, &str, &strAttribute, true) ||
-        xPathItemAlt.getValue((char)ret, &str, &strAttribute, true)) {
-#if CORE_DEBUG_LEVEL == 5      
-      log_v("item attribute (length=%d): %s", strAttribute.length(), strAttribute.c_str());
-      log_v("item (length=%d): %s", str.length(), str.c_str());
-      delay(1); // also resets task switcher watchdog
-#endif
-      if (soapScanItem(&objId, &strAttribute, &str, result))
-        countItem++;
-    }
-    if (xPathNumberReturned.getValue((char)ret, &str) ||
-        xPathNumberReturnedAlt.getValue((char)ret, &str)) {
-      count = str.toInt();
-      log_d("announced number of folders and/or files: %d", count);
-      break;  // numberReturned comes last, so we can break here
+    // itemize the comma separated list of capabilities
+    do {
+      if ((index = strCaps.indexOf(',', start)) >= 0) {
+        strItem = strCaps.substring(start, index);
+      }
+      else {
+        strItem = strCaps.substring(start);
+      }
+      start += strItem.length() + 1;
+      if (strItem.length()) result->push_back(strItem);
     }
+    while (start < strCaps.length());
   }
 
-  if (count == 0) {
-    log_i("XML scanned, no elements announced");
-  }
-  else if (count != (countContainer + countItem)) {
-    log_w("XML scanned, elements announced %d != found %d (possible reason: empty file or vital attributes missing)", 
-           count, countContainer + countItem);
-  }
-
-end_stop:
-  claimSPI();
-  m_client->stop();
-  releaseSPI();
-  log_i("found %d folders and %d files", countContainer, countItem);
-
-  // TEST
-#if CORE_DEBUG_LEVEL >= 4  
-  delay(3);
-#elif CORE_DEBUG_LEVEL >= 2
-  delay(1);
-#endif 
-
   return true;
 }
 
 //
-// browse a SOAP container object (directory) on a media server for content 
-//
-bool SoapESP32::browseServer(const unsigned int srv,         // server number in list
-                             const char *objectId,           // directory to browse, "0" represents root according to spec
-                             soapObjectVect_t *browseResult, // where to store browse results (directory content)
-                             // optional parameter
-                             const uint32_t startingIndex,   // offset into directory content list
-                             const uint16_t maxCount)        // limits number of objects in result list
-{
-  return soapProcessRequest(srv, objectId, browseResult, NULL, NULL, startingIndex, maxCount);
-}
-
-//
-// send a search request for files matching a special criteria to media server
+// querying a media server's SystemUpdateID, it changes whenever content of the server gets modified
 //
-bool SoapESP32::searchServer(const unsigned int srv,         // server number in list
-                             const char *objectId,           // start directory to search from, "0" for root
-                             soapObjectVect_t *searchResult, // where to store search results (file list)
-                             const char *searchCriteria1,    // search criteria, e.g. "dc:title contains"
-                             const char *param1,             // first criteria's parameter, e.g. "word"
-                             // optional parameter
-                             const char *searchCriteria2,    // optional search criteria, e.g. "upnp:class derivedfrom"
-                             const char *param2,             // 2nd criteria's parameter, e.g. "object.item.videoItem"
-                             const char *sortCriteria,       // optional sort criteria for results returned
-                             const uint32_t startingIndex,   // offset into content list
-                             const uint16_t maxCount)        // limits number of objects in result list
+bool SoapESP32::getSystemUpdateId(const unsigned int srv, uint32_t *updateId)
 {
-  String search((char *)0), sort((char *)0);
+  if (srv >= m_server.size()) {
+    log_e("invalid server number: %d", srv);
+    return false;
+  }
 
-  if (searchCriteria1 == NULL) return false;
+  log_i("querying SystemUpdateID from server: \"%s\"", m_server[srv].friendlyName.c_str());
 
-  // assemble final search criteria string
-  if (param1 != NULL) 
-    search = String(searchCriteria1) + " \"" + param1 + "\"";
-  if (searchCriteria2 != NULL) 
-    search += String(" and ") + searchCriteria2;
-  if (param2 != NULL) 
-    search += String(" \"") + param2 + "\"";
+  String strId((char *)0);
 
-  // define sort criteria string  
-  sort = (sortCriteria == NULL) ? SOAP_DEFAULT_SEARCH_SORT_CRITERIA : sortCriteria;
+  if (!soapQueryValue(srv, reqGetSystemUpdateId, xpGetSystemUpdateId, &strId) || strId.length() == 0) {
+    log_e("no SystemUpdateID delivered");
+    return false;
+  }
+  *updateId = strtoul(strId.c_str(), NULL, 10);
+  log_d("SystemUpdateID: %u", *updateId);
 
-  return soapProcessRequest(srv, objectId, searchResult, search.c_str(), sort.c_str(), startingIndex, maxCount);
+  return true;
 }
 
 //
-// querying a media server's search/sort capabilities
+// helper function, send a SOAP action without arguments to server and scan reply for a single value
+//  - returns false if request failed, value stays empty if not delivered by server
 //
-bool SoapESP32::getServerCapabilities(const unsigned int srv, eCapabilityType capability, soapServerCapVect_t *result)
+bool SoapESP32::soapQueryValue(const unsigned int srv, eSoapRequest request, int xpath, String *value)
 {
-  if (srv >= m_server.size()) {
-    log_e("invalid server number: %d", srv);
-    return false;
-  }
+  uint64_t contentSize;
+  bool chunked = false;
+  bool reusable = true;
+  MiniXPathSet xPathValue;
 
-  log_i("querying %s capabilities from server: \"%s\"", (capability == capSearch) ? "search" : "sort", m_server[srv].friendlyName.c_str());
+  *value = "";
 
-  // send SOAP browse/search request to server
-  if (!soapPostCapabilities(m_server[srv].ip, m_server[srv].port, m_server[srv].controlURL.c_str(), capability)) {
+  // send SOAP request to server
+  if (!soapPostAction(m_server[srv].ip, m_server[srv].port, m_server[srv].controlURL.c_str(), request)) {
     return false;
   }  
   log_i("connected successfully to server %s:%d", m_server[srv].ip.toString().c_str(), m_server[srv].port);
 
-  uint64_t contentSize;
-  bool chunked = false;
-  MiniXPath xPathCaps, xPathCapsAlt;
-  String strCaps((char *)0);
-
   // reading HTTP header
   if (!soapReadHttpHeader(&contentSize, &chunked)) {
     log_e("HTTP Header not ok or reply status not 200");
@@ -1201,60 +4276,29 @@ bool SoapESP32::getServerCapabilities(const unsigned int srv, eCapabilityType ca
   } 
   log_i("scan answer from media server:"); 
 
-  result->clear();
-
   // HTTP header ok, now scan XML/SOAP reply
-  int eNum = (capability == capSearch) ? xpGetSearchCapabilities : xpGetSortCapabilities;
-  xPathCaps.setPath(&xmlParserPaths[eNum++]);
-  xPathCapsAlt.setPath(&xmlParserPaths[eNum]);
+  xPathValue.addPath(&xmlParserPaths[xpath]);
 
   while (true) {
     int ret = soapReadXML(chunked, true);  // de-chunk data stream and replace XML-entities (if found)
     if (ret < 0) {
       log_e("soapReadXML() returned: %d%s", ret, ret == -1 ? " (likely EOF)" : ""); 
-      goto end_stop;
+      reusable = chunked ? m_chunkEnd : (m_bodyRemaining == 0);
+      *value = "";
+      break;
     }  
 
-    if (xPathCaps.getValue((char)ret, &strCaps) ||
-        xPathCapsAlt.getValue((char)ret, &strCaps)) {
+    if (xPathValue.getValue((char)ret, value) >= 0) {
 #if CORE_DEBUG_LEVEL == 5
-      log_v("\n%sCaps (length=%d): \"%s\"", (capability == capSearch) ? "Search" : "Sort", strCaps.length(), strCaps.c_str());
+      log_v("\nvalue (length=%d): \"%s\"", value->length(), value->c_str());
       delay(1);
 #endif
+      statsTime(parsedUs);
       break;
     }
   }
 
-  if (strCaps.length()) {
-    unsigned int start = 0;
-    int index;
-    String strItem((char *)0);
-
-    // itemize the comma separated list of capabilities
-    do {
-      if ((index = strCaps.indexOf(',', start)) >= 0) {
-        strItem = strCaps.substring(start, index);
-      }
-      else {
-        strItem = strCaps.substring(start);
-      }
-      start += strItem.length() + 1;
-      if (strItem.length()) result->push_back(strItem);
-    }
-    while (start < strCaps.length());
-  }
-
-end_stop:
-  claimSPI();
-  m_client->stop();
-  releaseSPI();
-
-  // TEST
-#if CORE_DEBUG_LEVEL >= 4  
-  delay(3);
-#elif CORE_DEBUG_LEVEL >= 2
-  delay(1);
-#endif  
+  soapClientRelease(reusable && soapSkipBody(chunked));
 
   return true;
 }
@@ -1274,6 +4318,7 @@ bool SoapESP32::readStart(soapObject_t *object, size_t *size)
 
   // just to make sure old connection is closed
   if (m_clientDataConOpen) {
+    soapReadAheadStop();
     claimSPI();
     m_client->stop();
     releaseSPI();
@@ -1281,43 +4326,133 @@ bool SoapESP32::readStart(soapObject_t *object, size_t *size)
     log_w("client data connection to media server was still open. Closed now.");
   }
 
-  // establish connection to server and send GET request
-  if (!soapGet(object->downloadIp, object->downloadPort, object->uri.c_str())) {
+  // establish connection to server and send GET request
+  if (!soapGet(object->downloadIp, object->downloadPort, object->uri.c_str())) {
+    return false;
+  }
+
+  // connection established, read HTTP header
+  if (!soapReadHttpHeader(&contentSize, &chunked)) {
+    // error returned
+    log_e("soapReadHttpHeader() was unsuccessful.");
+    claimSPI();
+    m_client->stop();
+    releaseSPI();
+    return false;
+  }
+
+  if (!soapDownloadStart(contentSize, chunked, object->size, &contentSize)) return false;
+  if (size) *size = (size_t)contentSize;
+
+  return true;
+}
+
+//
+// request part of object (file) from media server: length bytes (0: up to end of file) starting at 
+// offset, e.g. for seeking within a track or resuming an interrupted download. Files bigger than 
+// 4.2GB can be read in windows this way. The server must support HTTP ranges (206 Partial Content), 
+// range->status tells whether it does. range->size is the number of bytes read() delivers
+//
+bool SoapESP32::readStart(soapObject_t *object, uint64_t offset, uint64_t length, soapRange_t *range)
+{
+  char rangeHeader[64];
+  uint64_t contentSize, expected;
+  bool chunked;
+
+  *range = soapRange_t();
+  if (object->isDirectory) return false;
+
+  if (length) {
+    snprintf(rangeHeader, sizeof(rangeHeader), HEADER_RANGE "%llu-%llu\r\n", offset, offset + length - 1);
+  }
+  else {
+    snprintf(rangeHeader, sizeof(rangeHeader), HEADER_RANGE "%llu-\r\n", offset);
+  }
+  log_i("server ip: %s, port: %d, uri: \"%s\", offset: %llu, length: %llu", 
+        object->downloadIp.toString().c_str(), object->downloadPort, object->uri.c_str(), offset, length);
+
+  // establish connection to server and send GET request incl. range
+  if (!soapGet(object->downloadIp, object->downloadPort, object->uri.c_str(), true, rangeHeader)) {
+    return false;
+  }
+
+  // connection established, read HTTP header
+  m_rangeRequest = true;
+  bool ok = soapReadHttpHeader(&contentSize, &chunked);
+  m_rangeRequest = false;
+  if (!ok) {
+    if (m_httpStatus == HTTP_STATUS_RANGE_NOT_SATISFIABLE) {
+      range->status = rangeNotSatisfiable;
+      log_e("range not satisfiable, offset %llu beyond end of file ?", offset);
+    }
+    else {
+      log_e("soapReadHttpHeader() was unsuccessful.");
+    }
+    claimSPI();
+    m_client->stop();
+    releaseSPI();
+    return false;
+  }
+
+  if (m_httpStatus == HTTP_STATUS_PARTIAL_CONTENT) {
+    if (!m_contentRange.size || m_contentRange.first != offset) {
+      log_e("missing or unexpected Content-Range, first byte: %llu", m_contentRange.first);
+      claimSPI();
+      m_client->stop();
+      releaseSPI();
+      return false;
+    }
+    range->status = rangePartial;
+    range->first = offset;
+    range->total = m_contentRange.total;
+    expected = contentSize ? contentSize : m_contentRange.size;
+  }
+  else {
+    // server ignored range and delivers whole file
+    if (offset > 0) {
+      range->status = rangeIgnored;
+      log_e("server doesn't support HTTP ranges, download from offset %llu not possible", offset);
+      claimSPI();
+      m_client->stop();
+      releaseSPI();
+      return false;
+    }
+    range->status = rangeFull;
+    expected = contentSize ? contentSize : object->size;
+    range->total = expected;
+    if (length && (!expected || expected > length)) expected = length;   // rest gets dropped with readStop()
+  }
+
+  if (!soapDownloadStart(expected, chunked, 0, &range->size, UINT64_MAX)) {
+    range->status = rangeError;
     return false;
   }
 
-  // connection established, read HTTP header
-  if (!soapReadHttpHeader(&contentSize, &chunked)) {
-    // error returned
-    log_e("soapReadHttpHeader() was unsuccessful.");
-    claimSPI();
-    m_client->stop();
-    releaseSPI();
-    return false;
-  }
+  return true;
+}
 
-  // max allowed file size for download is 4.2GB (SIZE_MAX)
-  if (contentSize > (uint64_t)SIZE_MAX) {
-    log_e("file too big for download. Maximum allowed file size is 4.2GB.");
-    claimSPI();
-    m_client->stop();
-    releaseSPI();
-    return false;
-  }
-  
+//
+// helper function, prepare reading file data after HTTP header has been read
+//
+bool SoapESP32::soapDownloadStart(uint64_t contentSize, bool chunked, uint64_t objectSize, uint64_t *size,
+                                  uint64_t maxSize)
+{
   m_clientDataAvailable = 0;
   m_clientDataChunked = chunked;
   m_ChunkCount = 0;
+  m_chunkState = chunkSize;
+  m_chunkDigits = 0;
+  m_chunkEnd = false;
 
   if (contentSize > 0) {
     // file size announced in HTTP header
     log_d("media file size taken from http header: %llu", contentSize);
-    m_clientDataAvailable = (size_t)contentSize;
+    m_clientDataAvailable = contentSize;
   }
-  else if (object->size > 0) {
+  else if (objectSize > 0) {
     // as an alternative we use file size given in function argument
-    log_d("media file size taken from argument (media object): %llu", object->size);
-    m_clientDataAvailable = (size_t)object->size;
+    log_d("media file size taken from argument (media object): %llu", objectSize);
+    m_clientDataAvailable = objectSize;
   }
 
   if (m_clientDataAvailable == 0) {  
@@ -1328,78 +4463,87 @@ bool SoapESP32::readStart(soapObject_t *object, size_t *size)
     releaseSPI();
     return false;
   } 
+  if (m_clientDataAvailable > maxSize) {
+    // size_t limits a download to 4.2GB, bigger files need readStart() with offset & length
+    log_e("file too big for download. Maximum allowed file size is 4.2GB.");
+    claimSPI();
+    m_client->stop();
+    releaseSPI();
+    return false;
+  }
 
   m_clientDataConOpen = true;
   if (size) {                            // pointer valid ?
     *size = m_clientDataAvailable;       // return size of file
   }
+  if (m_readAhead) soapReadAheadStart();
 
   return true; 
 }
 
 //
 // read up to size bytes from server and place them into buf
-// returnes number of bytes read, -1 in case of read timeout or -2...-5 in case of other errors
+// returnes number of bytes read, -1 in case of read timeout or -2...-4 in case of de-chunking errors
 // Remarks: 
 // - older WiFi library versions & the Ethernet library return -1 if connection is still up but 
 //   momentarily no data available and return 0 in case of EOF. Newer WiFi versions return 0 in 
 //   both cases, so we need to treat -1 & 0 equally.
 // - timeout checking is vital because client.read() can return 0 for ages in case of WiFi problems
+// - timeout 0 returns at once if no data has been received yet (polling)
+// - with read-ahead enabled (setReadAhead()) data gets served from the read-ahead buffer
 //
 int SoapESP32::read(uint8_t *buf, size_t size, uint32_t timeout) {
 
   // first some basic checks
   if (!buf || !size || !m_clientDataConOpen) return -1;  // clearly an error
+  if (m_readAhead && m_readAhead->task) return soapReadAheadRead(buf, size, timeout);
+
+  return soapDownloadRead(buf, size, timeout);
+}
+
+//
+// helper function, read up to size bytes of the download straight from server, same return values 
+// as read(). With span given the data isn't copied to buf, span points to it in the receive buffer
+//
+int SoapESP32::soapDownloadRead(uint8_t *buf, size_t size, uint32_t timeout, const uint8_t **span)
+{
   if (!m_clientDataAvailable) return 0;                  // most probably EOF
 
   int res = -1;  
   uint32_t start = millis();
   
+  if (m_clientDataAvailable < size) size = m_clientDataAvailable;
   while (1) {
-    //if (m_clientDataAvailable < size) size = m_clientDataAvailable;
     if (!m_clientDataChunked) {
-      claimSPI();
-      res = m_client->read(buf, size);
-      releaseSPI();
+      res = span ? soapClientSpan(span, size) : soapClientRead(buf, size);
+    }
+    else if (!span && m_chunkState == chunkData && m_rxHead >= m_rxTail) {
+      // receive buffer used up, rest of chunk straight from client
+      res = soapClientRead(buf, (size < (size_t)m_ChunkCount) ? size : m_ChunkCount);
+      if (res > 0) soapChunkConsume(res);
     }
     else {
-      // de-chunking of data required   
-      if (m_ChunkCount <= 0) {
-        char tmpBuffer[10];
-      
-        // next line contains chunk size
-        claimSPI();
-        int len = m_client->readBytesUntil('\n', tmpBuffer, sizeof(tmpBuffer) - 1);
-        releaseSPI();
-        if (len < 2) {
-          log_e("error reading chunk size");     
-          return -2;   // we expect at least 1 digit chunk size + '\r'
-        }
-        tmpBuffer[len-1] = 0;           // clear '\r'
-        if (sscanf(tmpBuffer, "%x", &m_ChunkCount) != 1) {
-          log_e("error scanning chunk size");  
-          return -3;
-        }
-        log_d("announced chunk size: 0x%x(%d)", m_ChunkCount, m_ChunkCount);
-        if (m_ChunkCount <= 0) {
-          return -4;                    // not necessarily an error...final chunk size can be 0
-        }
+      // de-chunking of data required: chunk framing is consumed from receive buffer, buf gets the 
+      // data of as many chunks as have been received. Framing following a span is not touched 
+      // before next call (receive buffer might get refilled)
+      int n = 0;
+      res = 0;
+      while ((size_t)res < size && (n = soapChunkData(false)) > 0) {
+        if ((size_t)n > size - res) n = size - res;
+        if (span) *span = m_rxBuffer + m_rxHead;
+        else memcpy(buf + res, m_rxBuffer + m_rxHead, n);
+        m_rxHead += n;
+        soapChunkConsume(n);
+        res += n;
+        if (span) break;
       }
-      // read maximal till end of chunk
-      if (m_ChunkCount < size) size = m_ChunkCount;
-      claimSPI();
-      res = m_client->read(buf, size);
-      releaseSPI();
-      if (res > 0) {
-        m_ChunkCount -= res;
-        // check for end of chunk
-        if (m_ChunkCount == 0) {
-          // skip "\r\n" trailing each chunk
-          if (soapClientTimedRead(10) < 0 || soapClientTimedRead(10) < 0) {
-            log_e("error reading chunk trailing CR+LF");  
-            return -5;   
-          }
+      if (!res) {
+        if (n != SOAP_WOULD_BLOCK) {
+          if (n == -4) log_e("final chunk received, %llu bytes missing", m_clientDataAvailable);
+          else if (n < -1) log_e("error de-chunking data: %d", n);
+          return n;
         }
+        res = -1;                       // no data yet
       }
     }
     if (res > 0) {
@@ -1407,16 +4551,58 @@ int SoapESP32::read(uint8_t *buf, size_t size, uint32_t timeout) {
       m_clientDataAvailable -= res;
       break;
     }  
-    if ((millis() - start) > timeout) {
-      // read timeout
-      log_e("error, read timeout: %d ms", timeout);
+    if ((millis() - start) >= timeout) {
+      // read timeout, with timeout 0 we just poll
+      if (timeout) log_e("error, read timeout: %d ms", timeout);
       break;
     }
+    idleSPI();
   }
 
   return res;
 }
 
+//
+// hand the rest of the download (after readStart()) over to sink without copying it to a buffer of
+// the caller first: sink gets spans of the receive buffer (de-chunked) or, with read-ahead enabled,
+// of the read-ahead buffer and has to consume the data before returning. Returns true if the whole
+// download has been handed over, false in case of read error or if sink returned false. Number of
+// bytes handed over is returned in size (optional)
+//
+bool SoapESP32::readTo(soapSinkCallback_t sink, void *arg, uint64_t *size)
+{
+  uint64_t total = 0;
+  bool ok = !!sink;
+
+  while (ok && m_clientDataConOpen && available()) {
+    const uint8_t *data;
+    int res;
+
+    if (m_readAhead && m_readAhead->task) {
+      // contiguous part of read-ahead buffer, released after sink is done with it
+      if ((res = soapReadAheadWait(SERVER_READ_TIMEOUT)) > 0) {
+        size_t n = m_readAhead->size - m_readAhead->tail;
+        if ((size_t)res > n) res = n;
+        data = m_readAhead->buffer + m_readAhead->tail;
+        ok = sink(data, res, arg);
+        soapReadAheadConsume(res);
+      }
+    }
+    else if ((res = soapDownloadRead(NULL, SIZE_MAX, SERVER_READ_TIMEOUT, &data)) > 0) {
+      ok = sink(data, res, arg);
+    }
+    if (res <= 0) {
+      log_e("error reading download: %d", res);
+      ok = false;
+      break;
+    }
+    total += res;
+  }
+  if (size) *size = total;
+
+  return ok && m_clientDataConOpen;
+}
+
 //
 // read a single byte from server, return -1 in case of error
 //
@@ -1433,227 +4619,682 @@ int SoapESP32::read(void)
 void SoapESP32::readStop()
 {
   if (m_clientDataConOpen) {
+    soapReadAheadStop();
     claimSPI();
     m_client->stop();
     releaseSPI();
     m_clientDataConOpen = false;
     log_d("client data connection to media server closed");
+    statsTime(parsedUs);
+    statsEnd();
   }
   m_clientDataAvailable = 0;
   m_clientDataChunked = false;
   m_ChunkCount = 0;
+  m_rxHead = m_rxTail = 0;
 }
 
 //
-// HTTP GET request
+// enable read-ahead of downloads: readStart() starts a task that keeps reading from the server into
+// a buffer of bufferSize bytes, read() & available() get served from it. So a short stall of the 
+// network doesn't reach the caller of read(). The task pauses when the buffer is filled up to 
+// highWatermark (default: full buffer) and resumes when read() has drained it to lowWatermark 
+// (default: 3/4 of highWatermark). bufferSize 0 disables read-ahead. Not possible during a download.
 //
-bool SoapESP32::soapGet(const IPAddress ip, const uint16_t port, const char *uri)
+bool SoapESP32::setReadAhead(size_t bufferSize, size_t lowWatermark, size_t highWatermark)
 {
-  if (m_clientDataConOpen) {  
-    // can happen if a download wasn't properly finalized with readStop()
-    claimSPI();
-    m_client->stop();
-    releaseSPI();
-    m_clientDataConOpen = false;
-    log_w("client data connection to media server was still open. Closed now.");
+  soapReadAhead_t *ra;
+
+  if (m_readAhead && m_readAhead->task) {
+    log_e("not possible during a download, call readStop() first");
+    return false;
   }
+  if (m_readAhead) {
+    delete[] m_readAhead->buffer;
+    delete m_readAhead;
+    m_readAhead = NULL;
+  }
+  if (!bufferSize) return true;
 
-  for (int i = 0;;) {
+  if (!highWatermark || highWatermark > bufferSize) highWatermark = bufferSize;
+  if (!lowWatermark) lowWatermark = highWatermark - highWatermark / 4;
+  if (lowWatermark >= highWatermark) {
+    log_e("low watermark %u must be below high watermark %u", lowWatermark, highWatermark);
+    return false;
+  }
+  if (!(ra = new (std::nothrow) soapReadAhead_t()) || !(ra->buffer = new (std::nothrow) uint8_t[bufferSize])) {
+    log_e("no memory for read-ahead buffer of %u bytes", bufferSize);
+    delete ra;
+    return false;
+  }
+  ra->size = bufferSize;
+  ra->low = lowWatermark;
+  ra->high = highWatermark;
+  ra->stats.size = bufferSize;
+  m_readAhead = ra;
+  log_d("read-ahead buffer %u bytes, watermarks %u/%u", bufferSize, lowWatermark, highWatermark);
+
+  return true;
+}
+
+//
+// returns state of read-ahead buffer, counters refer to the current (or last) download
+//
+void SoapESP32::getReadAheadStats(soapReadAheadStats_t *stats)
+{
+  if (!m_readAhead) {
+    memset(stats, 0, sizeof(soapReadAheadStats_t));
+    return;
+  }
+  *stats = m_readAhead->stats;
+  stats->fill = m_readAhead->task ? (size_t)m_readAhead->fill : 0;
+}
+
+//
+// SPI bus usage since construction or last reset, e.g. to tune sharing the bus with SD card or display. 
+// Counters stay 0 with builtin WiFi or without SPI semaphore
+//
+void SoapESP32::getSPIStats(soapSPIStats_t *stats, bool reset)
+{
+  *stats = m_SPIStats;
+  if (reset) m_SPIStats = soapSPIStats_t();
+}
+
+//
+// timing breakdown & counters of the last request done (browse/search, capabilities, download, ...),
+// e.g. to find out whether the server, the network or parsing eats up the time. Returns false (and
+// stats all 0) if the library was built without option SOAP_REQUEST_STATS
+//
+bool SoapESP32::getLastRequestStats(soapRequestStats_t *stats)
+{
+#ifdef SOAP_REQUEST_STATS
+  *stats = m_reqStatsLast;
+  return true;
+#else
+  memset(stats, 0, sizeof(soapRequestStats_t));
+  return false;
+#endif
+}
+
+#ifdef SOAP_REQUEST_STATS
+//
+// helper function, a new request starts. A request still in progress (e.g. prefetched page 
+// dropped) doesn't get reported
+//
+void SoapESP32::soapStatsStart(void)
+{
+  m_reqStats = soapRequestStats_t();
+  m_reqStart = micros();
+  m_reqHeap = ESP.getFreeHeap();
+  m_reqOpen = true;
+}
+
+//
+// helper function, len bytes received from server
+//
+void SoapESP32::soapStatsReceived(int len)
+{
+  if (!m_reqStats.bytes) statsTime(firstByteUs);
+  m_reqStats.bytes += len;
+}
+
+//
+// helper function, request done (successfully or not), only the first call counts
+//
+void SoapESP32::soapStatsEnd(void)
+{
+  if (!m_reqOpen) return;
+  m_reqOpen = false;
+  statsTime(totalUs);
+  m_reqStats.heapDelta = (int32_t)ESP.getFreeHeap() - (int32_t)m_reqHeap;
+  m_reqStatsLast = m_reqStats;
+}
+#endif
+
+#ifdef USE_ETHERNET
+//
+// helper function, take SPI semaphore (if any) before using the Ethernet lib
+//
+void SoapESP32::soapClaimSPI(void)
+{
+  if (!m_SPIsem || !*m_SPIsem) return;
+
+  uint32_t start = micros(), wait;
+  while (xSemaphoreTake(*m_SPIsem, portMAX_DELAY) != pdTRUE);
+  m_SPIClaimed = micros();
+  wait = m_SPIClaimed - start;
+  m_SPIStats.acquisitions++;
+  m_SPIStats.waitUs += wait;
+  if (wait > m_SPIStats.maxWaitUs) m_SPIStats.maxWaitUs = wait;
+}
+
+//
+// helper function, give SPI semaphore back
+//
+void SoapESP32::soapReleaseSPI(void)
+{
+  if (!m_SPIsem || !*m_SPIsem) return;
+
+  uint32_t hold = micros() - m_SPIClaimed;
+  m_SPIStats.holdUs += hold;
+  if (hold > m_SPIStats.maxHoldUs) m_SPIStats.maxHoldUs = hold;
+  xSemaphoreGive(*m_SPIsem);
+}
+#endif
+
+//
+// helper function, start task reading ahead after HTTP header of download has been read. Without 
+// task the download gets read straight from server as usual
+//
+void SoapESP32::soapReadAheadStart(void)
+{
+  soapReadAhead_t *ra = m_readAhead;
+
+#ifdef USE_ETHERNET
+  // without SPI semaphore the Ethernet lib must not be used by several tasks
+  if (!m_SPIsem || !*m_SPIsem) {
+    log_w("no read-ahead without SPI semaphore");
+    return;
+  }
+#endif
+  ra->head = ra->tail = 0;
+  ra->fill = 0;
+  ra->left = m_clientDataAvailable;
+  ra->stop = ra->paused = ra->done = false;
+  ra->result = 0;
+  memset(&ra->stats, 0, sizeof(soapReadAheadStats_t));
+  ra->stats.size = ra->size;
+  ra->stats.minFill = ra->size;
+  if (xTaskCreate(soapReadAheadTask, "soapReadAhead", SOAP_READ_AHEAD_STACK, this, 
+                  uxTaskPriorityGet(NULL), &ra->task) != pdPASS) {
+    ra->task = NULL;
+    log_w("could not create task, reading without read-ahead");
+  }
+}
+
+//
+// helper function, stop task reading ahead, data still buffered gets dropped
+//
+void SoapESP32::soapReadAheadStop(void)
+{
+  if (!m_readAhead || !m_readAhead->task) return;
+
+  m_readAhead->stop = true;
+  xTaskNotifyGive(m_readAhead->task);
+  while (!m_readAhead->done) delay(1);
+  m_readAhead->task = NULL;
+  log_d("read-ahead stopped, %llu bytes received, %u underruns", 
+        m_readAhead->stats.received, m_readAhead->stats.underruns);
+}
+
+//
+// task function, read download into read-ahead buffer until all data has been received, an error 
+// occurred or readStop() has been called
+//
+void SoapESP32::soapReadAheadTask(void *arg)
+{
+  ((SoapESP32 *)arg)->soapReadAheadFill();
+  vTaskDelete(NULL);
+}
+
+//
+// helper function, producer side of read-ahead buffer. Only this task uses client & receive buffer
+// until it's done
+//
+void SoapESP32::soapReadAheadFill(void)
+{
+  soapReadAhead_t *ra = m_readAhead;
+  size_t fill, n;
+  int res = 0;
+
+  while (!ra->stop) {
+    fill = ra->fill;
+    if (fill >= ra->high) {
+      // wait until read() has made enough room
+      ra->paused = true;
+      ra->stats.pauses++;
+      while (ra->fill > ra->low && !ra->stop) ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(SOAP_READ_AHEAD_WAIT));
+      ra->paused = false;
+      continue;
+    }
+    // contiguous free space
+    n = ra->size - ra->head;
+    if (n > ra->size - fill) n = ra->size - fill;
+    res = soapDownloadRead(ra->buffer + ra->head, n, 0);
+    if (res > 0) {
+      ra->head = (ra->head + res) % ra->size;
+      ra->fill += res;
+      ra->stats.received += res;
+      continue;
+    }
+    if (res < -1) break;                 // de-chunking error or final chunk
+    if (!m_clientDataAvailable) {
+      res = 0;                           // all data received
+      break;
+    }
     claimSPI();
-    bool ret = m_client->connect(ip, port);
+    bool con = m_client->connected();
     releaseSPI();
-    if (ret) break;
-    if (++i >= 3) {
-      log_e("error connecting to server ip=%s, port=%d", ip.toString().c_str(), port);
-      return false;
+    if (!con) {
+      log_e("connection closed by server, %llu bytes missing", m_clientDataAvailable);
+      res = -1;
+      break;
     }
-    delay(100);  
+    vTaskDelay(1);                       // no data yet
   }
+  ra->result = res;
+  ra->done = true;
+}
 
-  // memory allocation for assembling HTTP header
-  size_t length = strlen(uri) + 25;
-  char *buffer = (char *)malloc(length);
-  if (!buffer) {
-    log_e("malloc() couldn't allocate memory");    
-    return false;
+//
+// helper function, consumer side of read-ahead buffer, same return values as read()
+//
+int SoapESP32::soapReadAheadRead(uint8_t *buf, size_t size, uint32_t timeout)
+{
+  soapReadAhead_t *ra = m_readAhead;
+  int fill = soapReadAheadWait(timeout);
+  size_t n;
+
+  if (fill <= 0) return fill;
+  if (size > (size_t)fill) size = fill;
+  n = ra->size - ra->tail;
+  if (n > size) n = size;
+  memcpy(buf, ra->buffer + ra->tail, n);
+  if (size > n) memcpy(buf + n, ra->buffer, size - n);
+  soapReadAheadConsume(size);
+
+  return size;
+}
+
+//
+// helper function, wait for data in read-ahead buffer. Returns number of bytes available or read()
+// error
+//
+int SoapESP32::soapReadAheadWait(uint32_t timeout)
+{
+  soapReadAhead_t *ra = m_readAhead;
+  uint32_t start = millis();
+  size_t fill = ra->fill;
+
+  if (ra->stats.delivered && fill < ra->stats.minFill) ra->stats.minFill = fill;
+  if (!fill) {
+    if (ra->stats.delivered && !ra->done) ra->stats.underruns++;
+    while (!(fill = ra->fill)) {
+      if (ra->done) {
+        // task adds data before it's done
+        if ((fill = ra->fill)) break;
+        return ra->result;
+      }
+      if ((millis() - start) >= timeout) {
+        // read timeout, with timeout 0 we just poll
+        if (timeout) log_e("error, read timeout: %d ms", timeout);
+        return -1;
+      }
+      delay(1);
+    }
   }
-  String str((char *)0);
 
-  // assemble HTTP header
-  snprintf(buffer, length, "GET /%s %s", uri, HTTP_VERSION);
-  str += buffer;
-  log_d("%s:%d %s", ip.toString().c_str(), port, buffer);
-  str += "\r\n";
-  snprintf(buffer, length, HEADER_HOST, ip.toString().c_str(), port);
-  str += buffer;
-  str += HEADER_CONNECTION_CLOSE;
-  str += HEADER_USER_AGENT;
-  str += HEADER_EMPTY_LINE;           // empty line marks end of HTTP header
+  return fill;
+}
 
-  // send request to server
-  claimSPI();
-  m_client->print(str);
-  releaseSPI();
+//
+// helper function, release size bytes of read-ahead buffer after they have been delivered
+//
+void SoapESP32::soapReadAheadConsume(size_t size)
+{
+  soapReadAhead_t *ra = m_readAhead;
+  size_t fill;
+
+  ra->tail = (ra->tail + size) % ra->size;
+  fill = (ra->fill -= size);
+  ra->left = (ra->left > size) ? ra->left - size : 0;
+  ra->stats.delivered += size;
+  if (ra->paused && fill <= ra->low) xTaskNotifyGive(ra->task);
+}
 
-  // give server some time to answer
-  uint32_t start = millis();
-  while (true) {
-    claimSPI();
-    int av = m_client->available();
-    releaseSPI();
-    if (av) break;
-    if (millis() > (start + SERVER_RESPONSE_TIMEOUT)) {
-      claimSPI();
-      m_client->stop();
-      releaseSPI();
-      log_e("GET: no reply from server for %d ms", SERVER_RESPONSE_TIMEOUT);
-      free(buffer);
-      return false;
+//
+// download a file over several connections at once, e.g. for copying big files to SD card when a
+// single connection is limited by TCP window & latency. The file gets split into segments of 
+// segmentSize bytes, each connection (own task & client) fetches every n-th segment with a range
+// request into its own buffer. Completed segments are handed to sink in order. With a server not 
+// supporting ranges, a file size not announced or connections 1 the file is downloaded over a single 
+// connection instead. Needs one buffer of segmentSize per connection.
+//
+bool SoapESP32::downloadSegmented(soapObject_t *object, soapSinkCallback_t sink, void *arg, 
+                                  unsigned int connections, size_t segmentSize)
+{
+  soapSegmentJob_t *job = NULL;
+  soapRange_t range;
+  uint64_t total = 0;
+  size_t size;
+  bool ok;
+
+  if (object->isDirectory || !sink || !segmentSize) return false;
+#ifdef USE_ETHERNET
+  // without SPI semaphore the Ethernet lib must not be used by several tasks
+  if (!m_SPIsem || !*m_SPIsem) connections = 1;
+#endif
+
+  // requesting the first byte tells about range support & file size
+  if (connections > 1 && readStart(object, 0, 1, &range)) {
+    readStop();
+    total = range.total ? range.total : object->size;
+    if (range.status == rangePartial && total > segmentSize) {
+      uint32_t segments = (total + segmentSize - 1) / segmentSize;
+      job = soapSegmentStart(object, total, segmentSize, min((uint32_t)connections, segments));
+    }
+  }
+  if (!job) {
+    // single connection
+    if (connections > 1) log_i("no segmented download, using a single connection");
+    if (!readStart(object, &size)) return false;
+    ok = readTo(sink, arg);
+    readStop();
+    return ok;
+  }
+
+  log_d("%u segments of %u bytes over %u connections", job->segments, segmentSize, job->workers);
+  ok = true;
+  for (uint32_t seg = 0; ok && seg < job->segments; seg++) {
+    soapSegmentWorker_t *w = &job->worker[seg % job->workers];
+
+    while (!(w->state == segReady && w->segment == seg) && w->state != segFailed) delay(1);
+    if (w->state == segFailed) {
+      log_e("fetching segment %u failed", seg);
+      ok = false;
+      break;
+    }
+    ok = sink(w->buffer, w->length, arg);
+    w->state = segFetching;       // buffer free for next segment
+  }
+  job->stop = true;
+  soapSegmentRelease(job);
+
+  return ok;
+}
+
+//
+// helper function, start tasks fetching the segments of a segmented download, returns NULL if 
+// there's not enough memory or a task couldn't be created
+//
+soapSegmentJob_t *SoapESP32::soapSegmentStart(const soapObject_t *object, uint64_t total, size_t segmentSize, 
+                                              unsigned int workers)
+{
+  soapSegmentJob_t *job = new (std::nothrow) soapSegmentJob_t();
+  unsigned int i;
+
+  if (!job || !(job->worker = new (std::nothrow) soapSegmentWorker_t[workers]())) {
+    log_e("no memory for segmented download");
+    delete job;
+    return NULL;
+  }
+  job->object = *object;
+#ifdef USE_ETHERNET
+  job->sem = m_SPIsem;
+#endif
+  job->total = total;
+  job->segmentSize = segmentSize;
+  job->segments = (total + segmentSize - 1) / segmentSize;
+  job->workers = workers;
+  for (i = 0; i < workers; i++) {
+    job->worker[i].job = job;
+    job->worker[i].segment = i;
+    if (!(job->worker[i].buffer = new (std::nothrow) uint8_t[segmentSize])) {
+      log_e("no memory for segment buffers");
+      break;
+    }
+  }
+  job->refs = 1;
+  if (i == workers) {
+    for (i = 0; i < workers; i++) {
+      job->refs++;
+      if (xTaskCreate(soapSegmentTask, "soapSegment", SOAP_SEGMENT_STACK, &job->worker[i], 
+                      uxTaskPriorityGet(NULL), NULL) != pdPASS) {
+        job->refs--;
+        log_e("could not create task");
+        break;
+      }
+    }
+    if (i == workers) return job;
+  }
+  // tasks already started finish on their own
+  job->stop = true;
+  soapSegmentRelease(job);
+
+  return NULL;
+}
+
+//
+// task function, fetch every n-th segment with own client and SoapESP32 object. The next segment 
+// is fetched as soon as the caller has handed the previous one to its sink
+//
+void SoapESP32::soapSegmentTask(void *arg)
+{
+  soapSegmentWorker_t *w = (soapSegmentWorker_t *)arg;
+  soapSegmentJob_t *job = w->job;
+
+  {
+    // own scope: client & object are gone before the task deletes itself
+#ifdef USE_ETHERNET
+    EthernetClient client;
+    SoapESP32 *soap = new (std::nothrow) SoapESP32(&client, NULL, job->sem);
+#else
+    WiFiClient client;
+    SoapESP32 *soap = new (std::nothrow) SoapESP32(&client);
+#endif
+    if (!soap) {
+      log_e("no memory for fetching segments");
+      w->state = segFailed;
+    }
+    for (uint32_t seg = w->segment; soap && seg < job->segments; seg += job->workers) {
+      // wait until caller is done with previous segment
+      while (w->state == segReady && !job->stop) delay(1);
+      if (job->stop) break;
+
+      uint64_t offset = (uint64_t)seg * job->segmentSize;
+      size_t length = (job->total - offset < job->segmentSize) ? (size_t)(job->total - offset) : job->segmentSize;
+      bool ok = false;
+      w->segment = seg;
+      for (int attempt = 0; attempt < 2 && !ok && !job->stop; attempt++) {
+        ok = soap->soapSegmentFetch(&job->object, offset, length, w->buffer);
+      }
+      if (!ok) {
+        w->state = segFailed;
+        break;
+      }
+      w->length = length;
+      w->state = segReady;
+    }
+    delete soap;
+  }
+  soapSegmentRelease(job);
+  vTaskDelete(NULL);
+}
+
+//
+// helper function, give up interest in a segmented download, the last one deletes it
+//
+void SoapESP32::soapSegmentRelease(soapSegmentJob_t *job)
+{
+  if (--job->refs > 0) return;
+  for (unsigned int i = 0; i < job->workers; i++) delete[] job->worker[i].buffer;
+  delete[] job->worker;
+  delete job;
+}
+
+//
+// helper function, fetch a single segment of a segmented download into buffer
+//
+bool SoapESP32::soapSegmentFetch(const soapObject_t *object, uint64_t offset, size_t length, uint8_t *buffer)
+{
+  soapObject_t obj = *object;
+  soapRange_t range;
+  size_t got = 0;
+
+  if (!readStart(&obj, offset, length, &range)) return false;
+  if (range.status == rangePartial && range.size == length) {
+    while (got < length) {
+      int res = read(buffer + got, length - got);
+      if (res <= 0) break;
+      got += res;
     }
   }
-  free(buffer);
+  readStop();
 
-  return true;
+  return got == length;
 }
 
 //
-// HTTP POST request (browse/search)
+// helper function, connect to server or reuse connection kept open from previous request
 //
-bool SoapESP32::soapPost(const IPAddress ip, 
-                         const uint16_t port, 
-                         const char *uri, 
-                         const char *objectId, 
-                         const char *searchCriteria,                               
-                         const char *sortCriteria,                               
-                         const uint32_t startingIndex, 
-                         const uint16_t maxCount)
+bool SoapESP32::soapConnect(const IPAddress ip, const uint16_t port, bool *reused)
 {
-  if (m_clientDataConOpen) {  
-    // can happen if a download wasn't properly finalized with readStop()
+  *reused = false;
+#ifndef USE_ETHERNET
+  if (m_async && m_async->state == asyncSend && m_async->connected && m_async->fd >= 0) {
+    // connected by soapAsyncConnect(): same socket options as WiFiClient::connect() sets, then hand over
+    int fd = m_async->fd, one = 1;
+    m_async->fd = -1;
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) & ~O_NONBLOCK);
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    setsockopt(fd, SOL_SOCKET, SO_KEEPALIVE, &one, sizeof(one));
+    *m_client = WiFiClient(fd);
+    m_conIdle = false;
+    m_conIp = ip;
+    m_conPort = port;
+    statsAdd(connectAttempts, m_async->attempts);
+    return true;
+  }
+#endif
+  if (m_conIdle) {
+    m_conIdle = false;
+    claimSPI();
+    bool alive = (ip == m_conIp && port == m_conPort && m_client->connected() && !m_client->available());
+    releaseSPI();
+    if (alive) {
+      log_d("reusing connection to server ip=%s, port=%d", ip.toString().c_str(), port);
+      *reused = true;
+      return true;
+    }
     claimSPI();
     m_client->stop();
     releaseSPI();
-    m_clientDataConOpen = false;
-    log_w("client data connection to media server was still open. Closed now.");
+    log_d("idle connection closed");
   }
 
   for (int i = 0;;) {
+    statsAdd(connectAttempts, 1);
     claimSPI();
+#ifdef USE_ETHERNET
     int ret = m_client->connect(ip, (uint16_t)port);
+#else
+    int ret = m_deadline ? m_client->connect(ip, (uint16_t)port, (int32_t)soapTimeLeft(SERVER_RESPONSE_TIMEOUT)) :
+                           m_client->connect(ip, (uint16_t)port);
+#endif
     releaseSPI();
     if (ret) break;
-    if (++i >= 3) {
+    if (++i >= 3 || soapTimeLeft(100) < 100) {
       log_e("error connecting to server ip=%s, port=%d", ip.toString().c_str(), port);
       return false;
     }  
     delay(100);  
   }
+  m_conIp = ip;
+  m_conPort = port;
 
-  // memory allocation for assembling HTTP header
-  size_t length = strlen(uri) + 30;
-  char *buffer = (char *)malloc(length);
-  if (!buffer) {
-    log_e("malloc() couldn't allocate memory");    
-    return false;
-  }
+  return true;
+}
 
-  bool search = (searchCriteria != NULL);
-  uint16_t messageLength;
-  char index[12], count[6];
-  String str((char *)0), str2((char *)0),
-         searchSortCriteria = (sortCriteria != NULL) ? sortCriteria : SOAP_DEFAULT_SEARCH_SORT_CRITERIA; 
-
-  itoa(startingIndex, index, 10);
-  itoa(maxCount, count, 10);
-
-  // assemble SOAP message
-  str2 += SOAP_ENVELOPE_START;
-  str2 += SOAP_BODY_START;
-  str2 += search ? SOAP_SEARCH_START : SOAP_BROWSE_START;
-  str2 += search ? SOAP_CONTAINERID_START : SOAP_OBJECTID_START;
-  str2 += objectId;
-  str2 += search ? SOAP_CONTAINERID_END : SOAP_OBJECTID_END;
-  str2 += search ? SOAP_SEARCHCRITERIA_START : SOAP_BROWSEFLAG_START;
-  str2 += search ? searchCriteria : SOAP_DEFAULT_BROWSE_FLAG;
-  str2 += search ? SOAP_SEARCHCRITERIA_END : SOAP_BROWSEFLAG_END;
-  str2 += SOAP_FILTER_START;
-  str2 += search ? SOAP_DEFAULT_SEARCH_FILTER : SOAP_DEFAULT_BROWSE_FILTER;
-  str2 += SOAP_FILTER_END;
-  str2 += SOAP_STARTINGINDEX_START;
-  str2 += index;
-  str2 += SOAP_STARTINGINDEX_END;
-  str2 += SOAP_REQUESTEDCOUNT_START;
-  str2 += count;
-  str2 += SOAP_REQUESTEDCOUNT_END;
-  str2 += SOAP_SORTCRITERIA_START;
-  str2 += search ? searchSortCriteria.c_str() : SOAP_DEFAULT_BROWSE_SORT_CRITERIA;
-  str2 += SOAP_SORTCRITERIA_END;
-  str2 += search ? SOAP_SEARCH_END : SOAP_BROWSE_END;
-  str2 += SOAP_BODY_END;
-  str2 += SOAP_ENVELOPE_END;
-  messageLength = strlen(str2.c_str());
-
-  // assemble HTTP header
-  snprintf(buffer, length, "POST /%s %s", uri, HTTP_VERSION);
-  str += buffer;
-  log_d("%s:%d %s", ip.toString().c_str(), port, buffer);
-  str += "\r\n";
-  snprintf(buffer, length, HEADER_HOST, ip.toString().c_str(), port); // 29 bytes max
-  str += buffer;
-  // TEST
-  str += "CACHE-CONTROL: no-cache\r\nPRAGMA: no-cache\r\n";
-  //str += "FRIENDLYNAME.DLNA.ORG: ESP32-Radio\r\n";
-  //
-  str += HEADER_CONNECTION_CLOSE;
-  snprintf(buffer, length, HEADER_CONTENT_LENGTH_D, messageLength);
-  str += buffer;
-  str += HEADER_CONTENT_TYPE;
-  str += search ? HEADER_SOAP_ACTION_SEARCH : HEADER_SOAP_ACTION_BROWSE;
-  str += HEADER_USER_AGENT;
-  str += HEADER_EMPTY_LINE;                    // empty line marks end of HTTP header
-  str += str2;                                 // add soap section
-  str2 = "";
+//
+// helper function, append data to transmit buffer, a full buffer gets sent
+//
+void SoapESP32::soapTxPut(const char *data, size_t length)
+{
+  while (length) {
+    size_t n = SOAP_TX_BUFFER_SIZE - m_txFill;
+    if (n > length) n = length;
+    memcpy(m_txBuffer + m_txFill, data, n);
+    m_txFill += n;
+    data += n;
+    length -= n;
+    if (m_txFill == SOAP_TX_BUFFER_SIZE) soapTxFlush();
+  }
+}
 
-  // send request to server
-#if CORE_DEBUG_LEVEL == 5
-  log_v("send %s request to server:\n%s", search ? "search" : "browse", str.c_str());
-  delay(1);
-#endif
+//
+// helper function, send content of transmit buffer
+//
+void SoapESP32::soapTxFlush(void)
+{
+  if (!m_txFill) return;
   claimSPI();
-  m_client->print(str);
+  m_client->write(m_txBuffer, m_txFill);
   releaseSPI();
+  m_txFill = 0;
+}
+
+//
+// helper function, serialize a request template: literal text gets copied, slot markers get 
+// replaced by the slot values (NULL means empty), objectId & criteria get XML-escaped on the fly. 
+// Only counts the bytes if send is false. Returns number of bytes.
+//
+size_t SoapESP32::soapSerialize(const char *tpl, const char **slot, bool send)
+{
+  size_t count = 0;
+  const char *p = tpl, *run;
 
-  // wait for a reply until timeout
-  uint32_t start = millis();
   while (true) {
-    claimSPI();
-    int av = m_client->available();
-    releaseSPI();
-    if (av) break;
-    if (millis() > (start + SERVER_RESPONSE_TIMEOUT)) {
-      claimSPI();
-      m_client->stop();
-      releaseSPI();
-      log_e("POST: no reply from server within %d ms", SERVER_RESPONSE_TIMEOUT);
-      free(buffer);
-      return false;
+    // literal text up to next slot marker
+    for (run = p; *p && ((uint8_t)*p < SOAP_SLOT_FIRST || (uint8_t)*p >= SOAP_SLOT_FIRST + slotTotal); p++);
+    if (send) soapTxPut(run, p - run);
+    count += p - run;
+    if (!*p) break;
+
+    int i = (uint8_t)*p++ - SOAP_SLOT_FIRST;
+    const char *value = slot[i];
+    if (!value) continue;
+    if (i < slotObjectId || i > slotSort) {
+      size_t n = strlen(value);
+      if (send) soapTxPut(value, n);
+      count += n;
+      continue;
+    }
+    for (run = value;; value++) {
+      char c = *value;
+      if (c && c != '&' && c != '<' && c != '>') continue;
+      if (send) soapTxPut(run, value - run);
+      count += value - run;
+      if (!c) break;
+      const char *entity = (c == '&') ? "&amp;" : (c == '<') ? "&lt;" : "&gt;";
+      if (send) soapTxPut(entity, strlen(entity));
+      count += strlen(entity);
+      run = value + 1;
     }
   }
-  free(buffer);
 
-  return true;
+  return count;
 }
 
 //
-// HTTP POST request (search/sort capabilities)
+// helper function, send request and wait for reply. If a reused connection turns out to be 
+// closed by server, the request gets sent again on a new connection
 //
-bool SoapESP32::soapPostCapabilities(const IPAddress ip, 
-                                     const uint16_t port, 
-                                     const char *uri, 
-                                     eCapabilityType capability)
+bool SoapESP32::soapSendRequest(const IPAddress ip, const uint16_t port, eSoapRequest request, 
+                                const char **slot, bool waitForReply)
 {
+  char host[24], length[12];
+  bool reused;
+
+  snprintf(host, sizeof(host), "%s:%d", ip.toString().c_str(), port);
+  slot[slotHost] = host;
+  snprintf(length, sizeof(length), "%u", (unsigned)soapSerialize(requestBodies[request], slot, false));
+  slot[slotLength] = length;
+
+  soapCancelPrefetch();
+  if (!soapDropAsync()) return false;
   if (m_clientDataConOpen) {  
     // can happen if a download wasn't properly finalized with readStop()
+    soapReadAheadStop();
     claimSPI();
     m_client->stop();
     releaseSPI();
@@ -1661,87 +5302,180 @@ bool SoapESP32::soapPostCapabilities(const IPAddress ip,
     log_w("client data connection to media server was still open. Closed now.");
   }
 
-  for (int i = 0;;) {
+  statsStart();
+  for (int attempt = 0; attempt < 2; attempt++) {
+    if (!soapConnect(ip, port, &reused)) {
+      statsEnd();
+      return false;
+    }
+    statsTime(connectUs);
+    m_conReused = reused;
+    m_txFill = 0;
+    soapSerialize(requestHeaders[request], slot, true);
+    soapSerialize(requestBodies[request], slot, true);
+#if CORE_DEBUG_LEVEL == 5
+    // bigger requests have been partly sent already
+    log_v("send request to server:\n%.*s", (int)m_txFill, (const char *)m_txBuffer);
+    delay(1);
+#endif
+    soapTxFlush();
+    statsTime(sentUs);
+    if (!waitForReply) return true;
+
+    // wait for a reply until timeout
+    uint32_t start = millis(), timeout = soapTimeLeft(SERVER_RESPONSE_TIMEOUT);
+    while (true) {
+      claimSPI();
+      int av = m_client->available();
+      bool con = av || m_client->connected();
+      releaseSPI();
+      if (av) return true;
+      if (!con && reused) break;
+      if (millis() - start > timeout) {
+        claimSPI();
+        m_client->stop();
+        releaseSPI();
+        log_e("%s: no reply from server within %d ms", requestMethods[request], (int)timeout);
+        statsEnd();
+        return false;
+      }
+      idleSPI();
+    }
     claimSPI();
-    int ret = m_client->connect(ip, (uint16_t)port);
+    m_client->stop();
     releaseSPI();
-    if (ret) break;
-    if (++i >= 3) {
-      log_e("error connecting to server ip=%s, port=%d", ip.toString().c_str(), port);
-      return false;
-    }  
-    delay(100);  
+    log_d("server closed kept-alive connection, sending request again");
   }
+  statsEnd();
 
-  // memory allocation for assembling HTTP header
-  size_t length = strlen(uri) + 30;
-  char *buffer = (char *)malloc(length);
-  if (!buffer) {
-    log_e("malloc() couldn't allocate memory");    
-    return false;
+  return false;
+}
+
+//
+// helper function, skip rest of reply body. Returns true if the connection is ready for
+// the next request afterwards.
+//
+bool SoapESP32::soapSkipBody(bool chunked)
+{
+  size_t n, skipped = 0;
+
+  if (m_conClose) return false;
+  if (!chunked) {
+    if (m_bodyRemaining > SOAP_KEEP_ALIVE_MAX_SKIP) return false;   // incl. unknown size
+    while (m_bodyRemaining > 0) {
+      if (m_rxHead >= m_rxTail && !soapClientFill()) return false;
+      n = m_rxTail - m_rxHead;
+      if (n > m_bodyRemaining) n = (size_t)m_bodyRemaining;
+      m_rxHead += n;
+      m_bodyRemaining -= n;
+    }
+  }
+  else {
+    // rest of chunks incl. trailer
+    while (true) {
+      int ret = soapChunkData(true);
+      if (ret == -4) break;
+      if (ret < 0 || (skipped += ret) > SOAP_KEEP_ALIVE_MAX_SKIP) return false;
+      m_rxHead += ret;
+      soapChunkConsume(ret);
+    }
   }
 
-  uint16_t messageLength;
-  String str((char *)0), str2((char *)0);
-
-  // assemble SOAP message
-  str2 += SOAP_ENVELOPE_START;
-  str2 += SOAP_BODY_START;
-  str2 += (capability == capSort) ? SOAP_GETSORTCAP_START : SOAP_GETSEARCHCAP_START;
-  str2 += (capability == capSort) ? SOAP_GETSORTCAP_END : SOAP_GETSEARCHCAP_END;
-  str2 += SOAP_BODY_END;
-  str2 += SOAP_ENVELOPE_END;
-  messageLength = strlen(str2.c_str());
-
-  // assemble HTTP header
-  snprintf(buffer, length, "POST /%s %s", uri, HTTP_VERSION);
-  str += buffer;
-  log_d("%s:%d %s", ip.toString().c_str(), port, buffer);
-  str += "\r\n";
-  snprintf(buffer, length, HEADER_HOST, ip.toString().c_str(), port); // 29 bytes max
-  str += buffer;
-  // TEST
-  str += "CACHE-CONTROL: no-cache\r\nPRAGMA: no-cache\r\n";
-  //str += "FRIENDLYNAME.DLNA.ORG: ESP32-Radio\r\n";
-  //
-  str += HEADER_CONNECTION_CLOSE;
-  snprintf(buffer, length, HEADER_CONTENT_LENGTH_D, messageLength);
-  str += buffer;
-  str += HEADER_CONTENT_TYPE;
-  str += (capability == capSort) ? HEADER_SOAP_ACTION_GETSORTCAP : HEADER_SOAP_ACTION_GETSEARCHCAP;
-  str += HEADER_USER_AGENT;
-  str += HEADER_EMPTY_LINE;                    // empty line marks end of HTTP header
-  str += str2;                                 // add soap section
-  str2 = "";
+  return m_rxHead >= m_rxTail;  // anything else would spoil next reply
+}
 
-  // send request to server
-#if CORE_DEBUG_LEVEL == 5
-  log_v("send %s request to server:\n%s", capability == capSort ? "GetSortCapabilities" : "GetSearchCapabilities", str.c_str());
-  delay(1);
-#endif
+//
+// helper function, done with reply: keep connection open for next request if possible
+//
+void SoapESP32::soapClientRelease(bool reusable)
+{
+  statsEnd();
+  if (m_keepAlive && reusable) {
+    m_conIdle = true;
+    log_d("connection kept open for next request");
+    return;
+  }
   claimSPI();
-  m_client->print(str);
+  m_client->stop();
   releaseSPI();
+}
 
-  // wait for a reply until timeout
-  uint32_t start = millis();
-  while (true) {
+//
+// enable/disable HTTP keep-alive for browse/search/capability requests
+//
+void SoapESP32::setKeepAlive(bool enable)
+{
+  m_keepAlive = enable;
+  if (!enable && m_conIdle) {
     claimSPI();
-    int av = m_client->available();
+    m_client->stop();
     releaseSPI();
-    if (av) break;
-    if (millis() > (start + SERVER_RESPONSE_TIMEOUT)) {
-      claimSPI();
-      m_client->stop();
-      releaseSPI();
-      log_e("POST: no reply from server within %d ms", SERVER_RESPONSE_TIMEOUT);
-      free(buffer);
-      return false;
-    }
+    m_conIdle = false;
   }
-  free(buffer);
+}
 
-  return true;
+//
+// HTTP GET request
+//
+bool SoapESP32::soapGet(const IPAddress ip, const uint16_t port, const char *uri, bool waitForReply, const char *range)
+{
+  const char *slot[slotTotal] = { NULL };
+
+  slot[slotUri] = uri;
+  slot[slotRange] = range;              // complete header line or NULL
+  log_d("%s:%d GET /%s %s", ip.toString().c_str(), port, uri, HTTP_VERSION);
+
+  // send request to server
+  return soapSendRequest(ip, port, reqGet, slot, waitForReply);
+}
+
+//
+// HTTP POST request (browse/search)
+//
+bool SoapESP32::soapPost(const IPAddress ip, 
+                         const uint16_t port, 
+                         const char *uri, 
+                         const char *objectId, 
+                         const char *searchCriteria,                               
+                         const char *sortCriteria,                               
+                         const uint32_t startingIndex, 
+                         const uint16_t maxCount,
+                         bool waitForReply)
+{
+  const char *slot[slotTotal] = { NULL };
+  char index[12], count[6];
+
+  snprintf(index, sizeof(index), "%u", startingIndex);
+  snprintf(count, sizeof(count), "%u", maxCount);
+  slot[slotUri] = uri;
+  slot[slotConnection] = m_keepAlive ? HEADER_CONNECTION_KEEP_ALIVE : HEADER_CONNECTION_CLOSE;
+  slot[slotObjectId] = objectId;
+  slot[slotCriteria] = searchCriteria;
+  slot[slotSort] = sortCriteria;                // NULL: SOAP_DEFAULT_SEARCH_SORT_CRITERIA
+  slot[slotIndex] = index;
+  slot[slotCount] = count;
+  log_d("%s:%d POST /%s %s", ip.toString().c_str(), port, uri, HTTP_VERSION);
+
+  // send request to server
+  return soapSendRequest(ip, port, (searchCriteria != NULL) ? reqSearch : reqBrowse, slot, waitForReply);
+}
+
+//
+// HTTP POST request (SOAP action without arguments, e.g. search/sort capabilities)
+//
+bool SoapESP32::soapPostAction(const IPAddress ip, 
+                               const uint16_t port, 
+                               const char *uri, 
+                               eSoapRequest request)
+{
+  const char *slot[slotTotal] = { NULL };
+
+  slot[slotUri] = uri;
+  slot[slotConnection] = m_keepAlive ? HEADER_CONNECTION_KEEP_ALIVE : HEADER_CONNECTION_CLOSE;
+  log_d("%s:%d POST /%s %s", ip.toString().c_str(), port, uri, HTTP_VERSION);
+
+  // send request to server
+  return soapSendRequest(ip, port, request, slot, true);
 }
 
 //
@@ -1764,11 +5498,15 @@ bool SoapESP32::getServerInfo(unsigned int srv, soapServer_t *serverInfo)
 }
 
 //
-// returns number of available/remaining bytes
+// returns number of available/remaining bytes, SIZE_MAX if more are left (download > 4.2GB)
 //
 size_t SoapESP32::available()
 {
-  return m_clientDataConOpen ? m_clientDataAvailable : 0;
+  if (!m_clientDataConOpen) return 0;
+
+  uint64_t left = (m_readAhead && m_readAhead->task) ? m_readAhead->left : m_clientDataAvailable;
+
+  return (left > SIZE_MAX) ? SIZE_MAX : (size_t)left;
 }
 
 //
@@ -1778,3 +5516,267 @@ const char *SoapESP32::getFileTypeName(eFileType fileType)
 {
   return (fileTypeAudio <= fileType && fileType <= fileTypeVideo) ? fileTypes[fileType] : fileTypes[fileTypeOther];
 }
+
+//
+// SoapResultSet Class Constructor, memory gets allocated with first use
+//
+SoapResultSet::SoapResultSet(size_t arenaSize, size_t objects)
+  : m_arena(NULL), m_arenaSize(arenaSize), m_arenaUsed(0), m_objects(NULL), m_objectsSize(objects), 
+    m_count(0), m_parentId(0), m_full(false), m_limit(0)
+{
+}
+
+SoapResultSet::~SoapResultSet()
+{
+  free(m_arena);
+  free(m_objects);
+}
+
+//
+// make sure arena & object list can take additional bytes/objects, both grow by doubling
+// unless the memory limit would be exceeded
+//
+bool SoapResultSet::reserve(size_t bytes, size_t objects)
+{
+  size_t used = m_arena ? m_arenaUsed : 1;
+  size_t arenaSize = m_arenaSize ? m_arenaSize : SOAP_RESULT_SET_ARENA_SIZE;
+  size_t objectsSize = m_objectsSize ? m_objectsSize : SOAP_RESULT_SET_OBJECTS;
+
+  while (used + bytes > arenaSize) arenaSize *= 2;
+  while (m_count + objects > objectsSize) objectsSize *= 2;
+  if (m_limit && arenaSize + objectsSize * sizeof(soapCompactObject_t) > m_limit) {
+    // close to the limit arena/object list only grow into what's left
+    size_t left = (m_limit > objectsSize * sizeof(soapCompactObject_t)) ? m_limit - objectsSize * sizeof(soapCompactObject_t) : 0;
+    if (arenaSize > m_arenaSize && left >= used + bytes) arenaSize = left;
+    left = (m_limit > arenaSize) ? (m_limit - arenaSize) / sizeof(soapCompactObject_t) : 0;
+    if (objectsSize > m_objectsSize && left >= m_count + objects) objectsSize = left;
+    if (arenaSize + objectsSize * sizeof(soapCompactObject_t) > m_limit) {
+      log_d("set would exceed memory limit of %d bytes", m_limit);
+      return false;
+    }
+  }
+  if (!m_arena || arenaSize > m_arenaSize) {
+    char *p = (char *)realloc(m_arena, arenaSize);
+    if (!p) {
+      log_e("no memory for arena of %d bytes", arenaSize);
+      return false;
+    }
+    if (!m_arena) {
+      p[0] = 0;               // offset 0 always holds an empty string
+      m_arenaUsed = used;
+    }
+    m_arena = p;
+    m_arenaSize = arenaSize;
+  }
+  if (!m_objects || objectsSize > m_objectsSize) {
+    soapCompactObject_t *p = (soapCompactObject_t *)realloc(m_objects, objectsSize * sizeof(soapCompactObject_t));
+    if (!p) {
+      log_e("no memory for %d objects", objectsSize);
+      return false;
+    }
+    m_objects = p;
+    m_objectsSize = objectsSize;
+  }
+
+  return true;
+}
+
+//
+// copy string into arena, empty strings don't take any space
+//
+bool SoapResultSet::storeString(const char *str, uint32_t *offset)
+{
+  size_t length = strlen(str);
+
+  if (length == 0) {
+    *offset = 0;
+    return true;
+  }
+  if (!reserve(length + 1, 0)) return false;
+  memcpy(m_arena + m_arenaUsed, str, length + 1);
+  *offset = m_arenaUsed;
+  m_arenaUsed += length + 1;
+
+  return true;
+}
+
+//
+// empty the set (memory is kept for next use) and store the parent id shared by all objects
+//
+void SoapResultSet::clear(const char *parentId)
+{
+  m_count = 0;
+  m_arenaUsed = m_arena ? 1 : 0;
+  m_parentId = 0;
+  m_full = false;
+  if (parentId && !storeString(parentId, &m_parentId)) m_full = true;
+}
+
+//
+// add an object to the set
+//
+bool SoapResultSet::add(const soapObject_t *object)
+{
+  soapCompactObject_t o;
+  size_t arenaUsed = m_arenaUsed;
+
+  if (!reserve(0, 1)) goto NO_MEMORY;
+  if (m_arena && object->parentId == getParentId()) {
+    o.parentId = m_parentId;  
+  }
+  else if (!storeString(object->parentId.c_str(), &o.parentId)) {
+    goto NO_MEMORY;
+  }
+  if (!storeString(object->id.c_str(), &o.id) ||
+      !storeString(object->name.c_str(), &o.name) ||
+      !storeString(object->artist.c_str(), &o.artist) ||
+      !storeString(object->album.c_str(), &o.album) ||
+      !storeString(object->genre.c_str(), &o.genre) ||
+#if !defined(NO_PROTOCOL_INFO)
+      !storeString(object->protInfo.c_str(), &o.protInfo) ||
+#endif
+      !storeString(object->uri.c_str(), &o.uri)) {
+    goto NO_MEMORY;
+  }
+  o.size = object->size;
+  o.downloadIp = (uint32_t)object->downloadIp;
+  o.bitrate = object->bitrate;
+  o.sampleFrequency = object->sampleFrequency;
+  o.downloadPort = object->downloadPort;
+  o.fileType = (uint8_t)object->fileType;
+  o.isDirectory = object->isDirectory;
+  o.sizeMissing = object->sizeMissing;
+  o.searchable = object->searchable;
+  m_objects[m_count++] = o;
+
+  return true;
+
+NO_MEMORY:
+  m_arenaUsed = arenaUsed;    // drop strings of incomplete object
+  m_full = true;
+  return false;
+}
+
+//
+// returns pointer to parent id shared by objects
+//
+const char *SoapResultSet::getParentId(void) const
+{
+  return m_arena ? m_arena + m_parentId : "";
+}
+
+//
+// deliver a view of object with given index, no memory gets allocated
+//
+bool SoapResultSet::get(size_t index, soapObjectView_t *view) const
+{
+  if (index >= m_count) return false;
+
+  const soapCompactObject_t *o = &m_objects[index];
+  view->isDirectory = o->isDirectory;
+  view->size = o->size;
+  view->sizeMissing = o->sizeMissing;
+  view->bitrate = o->bitrate;
+  view->sampleFrequency = o->sampleFrequency;
+  view->searchable = o->searchable;
+  view->fileType = (eFileType)o->fileType;
+  view->parentId = m_arena + o->parentId;
+  view->id = m_arena + o->id;
+  view->name = m_arena + o->name;
+  view->artist = m_arena + o->artist;
+  view->album = m_arena + o->album;
+  view->genre = m_arena + o->genre;
+#if !defined(NO_PROTOCOL_INFO)
+  view->protInfo = m_arena + o->protInfo;
+#endif
+  view->uri = m_arena + o->uri;
+  view->downloadIp = IPAddress(o->downloadIp);
+  view->downloadPort = o->downloadPort;
+
+  return true;
+}
+
+//
+// deliver a full copy of object with given index, e.g. needed for readStart()
+//
+bool SoapResultSet::getObject(size_t index, soapObject_t *object) const
+{
+  soapObjectView_t view;
+
+  if (!get(index, &view)) return false;
+  object->isDirectory = view.isDirectory;
+  object->size = view.size;
+  object->sizeMissing = view.sizeMissing;
+  object->bitrate = view.bitrate;
+  object->sampleFrequency = view.sampleFrequency;
+  object->searchable = view.searchable;
+  object->fileType = view.fileType;
+  object->parentId = view.parentId;
+  object->id = view.id;
+  object->name = view.name;
+  object->artist = view.artist;
+  object->album = view.album;
+  object->genre = view.genre;
+#if !defined(NO_PROTOCOL_INFO)
+  object->protInfo = view.protInfo;
+#endif
+  object->uri = view.uri;
+  object->downloadIp = view.downloadIp;
+  object->downloadPort = view.downloadPort;
+
+  return true;
+}
+
+//
+// make the set an exact copy of another one, memory gets allocated without room to spare
+//
+bool SoapResultSet::assign(const SoapResultSet *other)
+{
+  if (other == this) return true;
+
+  clear(NULL);
+  if (!other->m_arena) return true;     // other set never used
+  if (m_limit && other->m_arenaUsed + other->m_count * sizeof(soapCompactObject_t) > m_limit) {
+    log_d("copy would exceed memory limit of %d bytes", m_limit);
+    m_full = true;
+    return false;
+  }
+  if (!m_arena || m_arenaSize < other->m_arenaUsed) {
+    char *p = (char *)realloc(m_arena, other->m_arenaUsed);
+    if (!p) {
+      log_e("no memory for arena of %d bytes", other->m_arenaUsed);
+      m_full = true;
+      return false;
+    }
+    m_arena = p;
+    m_arenaSize = other->m_arenaUsed;
+  }
+  if (other->m_count && (!m_objects || m_objectsSize < other->m_count)) {
+    soapCompactObject_t *p = (soapCompactObject_t *)realloc(m_objects, other->m_count * sizeof(soapCompactObject_t));
+    if (!p) {
+      log_e("no memory for %d objects", other->m_count);
+      m_arena[0] = 0;
+      m_arenaUsed = 1;
+      m_full = true;
+      return false;
+    }
+    m_objects = p;
+    m_objectsSize = other->m_count;
+  }
+  memcpy(m_arena, other->m_arena, other->m_arenaUsed);
+  if (other->m_count) memcpy(m_objects, other->m_objects, other->m_count * sizeof(soapCompactObject_t));
+  m_arenaUsed = other->m_arenaUsed;
+  m_count = other->m_count;
+  m_parentId = other->m_parentId;
+  m_full = other->m_full;
+
+  return true;
+}
+
+//
+// returns number of bytes allocated by the set
+//
+size_t SoapResultSet::getMemoryUsage(void) const
+{
+  return (m_arena ? m_arenaSize : 0) + (m_objects ? m_objectsSize * sizeof(soapCompactObject_t) : 0);
+}
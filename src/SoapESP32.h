@@ -43,6 +43,19 @@
 #define TMP_BUFFER_SIZE_400         400
 #define TMP_BUFFER_SIZE_1000       1000
 
+// receive buffer, filled in bulk from client
+#define SOAP_RX_BUFFER_SIZE        1024
+// browse/search replies get de-chunked & entity-decoded in blocks of this size before parsing
+#define SOAP_XML_BLOCK_SIZE         256
+// transmit buffer, requests get serialized into it and sent with a single write (if they fit)
+#define SOAP_TX_BUFFER_SIZE        1460
+
+// keep-alive: rest of a reply body gets skipped up to this size, bigger rest closes the connection
+#define SOAP_KEEP_ALIVE_MAX_SKIP   8192
+
+// returned by soapReadXML() when no data available yet (asynchronous requests only)
+#define SOAP_WOULD_BLOCK           -100
+
 // network communication timeouts
 #define SERVER_RESPONSE_TIMEOUT    3000   // ms
 #define SERVER_READ_TIMEOUT        3000   // ms
@@ -53,27 +66,55 @@
 #define SSDP_SCAN_DURATION           60   // seconds, default network scan duration for seekServer()
 #define SSDP_LOCATION_BUF_SIZE      150
 #define SSDP_M_SEARCH_REPEATS         2
-#define SSDP_M_SEARCH                "M-SEARCH * HTTP/1.1\r\nHOST: 239.255.255.250:1900\r\nMAN: \"ssdp:discover\"\r\nMX: 4\r\nST: "
+#define SSDP_DESCRIPTION_PARALLEL     4   // max. number of device descriptions fetched at once by seekServer()
+#define SSDP_DESCRIPTION_DEADLINE  5000   // ms, max. time for fetching & scanning a single device description
+#define SSDP_DESCRIPTION_STACK     6144   // stack size of a task fetching a device description
+#define SSDP_VALIDATE_DEADLINE     2000   // ms, max. time for checking a single server of a restored server list
+#define SERVER_LIST_HEADER           "#SoapESP32 server list"
+#define SERVER_LIST_VERSION           2   // version 1 lacks the event URL
+#define SSDP_M_SEARCH_MX              4   // seconds, servers delay their reply randomly up to this value
+#define SSDP_M_SEARCH_MX_FAST         1   // seconds, same for seekServerUntil()
+#define SSDP_M_SEARCH                "M-SEARCH * HTTP/1.1\r\nHOST: 239.255.255.250:1900\r\nMAN: \"ssdp:discover\"\r\nMX: "
 #define SSDP_DEVICE_TYPE_MS          "urn:schemas-upnp-org:device:MediaServer:1"
 #define SSDP_DEVICE_TYPE_RD          "upnp:rootdevice"
 #define SSDP_SERVICE_TYPE_CD         "urn:schemas-upnp-org:service:ContentDirectory:1"                                   
 #define SSDP_LOCATION                "Location: http://"
+#define SSDP_USN                     "\nUSN:"
+#define SSDP_UUID                    "uuid:"
 #define SSDP_NOTIFICATION            "NOTIFY * HTTP/1.1"
 #define SSDP_NOTIFICATION_SUB_TYPE   "ssdp:alive"
 
+// GENA eventing - ContentDirectory change notifications
+#define GENA_SUBSCRIPTION_TIMEOUT  1800   // s, requested duration of an event subscription
+#define GENA_RENEW_MARGIN            60   // s, subscription gets renewed this long before it expires
+#define GENA_RETRY_INTERVAL       30000   // ms, failed renewal gets retried after this time
+#define GENA_NOTIFY_TIMEOUT        1000   // ms, max. time for receiving a single event message
+#define GENA_CALLBACK_PATH           "soapesp32/event"
+#define GENA_NOTIFY                  "NOTIFY /"
+#define HEADER_SID                   "SID:"
+#define HEADER_SEQ                   "SEQ:"
+#define HEADER_TIMEOUT               "TIMEOUT:"
+#define HEADER_TIMEOUT_SECOND        "Second-"
+
 // HTTP header lines
 #define HTTP_VERSION                    "HTTP/1.1"
+#define HTTP_STATUS_OK                  200
+#define HTTP_STATUS_PARTIAL_CONTENT     206
+#define HTTP_STATUS_RANGE_NOT_SATISFIABLE 416
 #define HTTP_HEADER_200_OK              "HTTP/1.1 200 OK"
 #define HEADER_CONTENT_LENGTH           "Content-Length: "
-#define HEADER_HOST                     "Host: %s:%d\r\n"
+#define HEADER_HOST                     "Host: "
 #define HEADER_CONTENT_TYPE             "Content-Type: text/xml; charset=\"utf-8\"\r\n"
 #define HEADER_TRANS_ENC_CHUNKED        "Transfer-Encoding: chunked"
-#define HEADER_CONTENT_LENGTH_D         "Content-Length: %d\r\n"
+#define HEADER_RANGE                    "Range: bytes="
+#define HEADER_CONTENT_RANGE            "Content-Range:"
 #define HEADER_SOAP_ACTION_BROWSE       "SOAPAction: \"urn:schemas-upnp-org:service:ContentDirectory:1#Browse\"\r\n"
 #define HEADER_SOAP_ACTION_SEARCH       "SOAPAction: \"urn:schemas-upnp-org:service:ContentDirectory:1#Search\"\r\n"
 #define HEADER_SOAP_ACTION_GETSEARCHCAP "SOAPAction: \"urn:schemas-upnp-org:service:ContentDirectory:1#GetSearchCapabilities\"\r\n"
 #define HEADER_SOAP_ACTION_GETSORTCAP   "SOAPAction: \"urn:schemas-upnp-org:service:ContentDirectory:1#GetSortCapabilities\"\r\n"
+#define HEADER_SOAP_ACTION_GETSYSUPDID  "SOAPAction: \"urn:schemas-upnp-org:service:ContentDirectory:1#GetSystemUpdateID\"\r\n"
 #define HEADER_USER_AGENT               "User-Agent: ESP32/Player/UPNP1.0\r\n"
+#define HEADER_CONNECTION               "Connection:"
 #define HEADER_CONNECTION_CLOSE         "Connection: close\r\n"
 #define HEADER_CONNECTION_KEEP_ALIVE    "Connection: keep-alive\r\n"
 #define HEADER_EMPTY_LINE               "\r\n"
@@ -97,6 +138,8 @@
 #define SOAP_GETSEARCHCAP_END     "</u:GetSearchCapabilities>\r\n"
 #define SOAP_GETSORTCAP_START     "<u:GetSortCapabilities xmlns:u=\"urn:schemas-upnp-org:service:ContentDirectory:1\">\r\n"
 #define SOAP_GETSORTCAP_END       "</u:GetSortCapabilities>\r\n"
+#define SOAP_GETSYSUPDID_START    "<u:GetSystemUpdateID xmlns:u=\"urn:schemas-upnp-org:service:ContentDirectory:1\">\r\n"
+#define SOAP_GETSYSUPDID_END      "</u:GetSystemUpdateID>\r\n"
 #define SOAP_OBJECTID_START       "<ObjectID>"
 #define SOAP_OBJECTID_END         "</ObjectID>\r\n"
 #define SOAP_CONTAINERID_START    "<ContainerID>"
@@ -114,17 +157,55 @@
 #define SOAP_SORTCRITERIA_START   "<SortCriteria>"
 #define SOAP_SORTCRITERIA_END     "</SortCriteria>\r\n"
 
+// slot markers in request templates, get replaced by actual values when a request is serialized.
+// Order must match enum eSoapSlot
+#define SOAP_SLOT_FIRST           0x11
+#define SOAP_SLOT_URI             "\x11"
+#define SOAP_SLOT_HOST            "\x12"
+#define SOAP_SLOT_CONNECTION      "\x13"
+#define SOAP_SLOT_LENGTH          "\x14"
+#define SOAP_SLOT_OBJECTID        "\x15"    // XML-escaped
+#define SOAP_SLOT_CRITERIA        "\x16"    // XML-escaped
+#define SOAP_SLOT_SORT            "\x17"    // XML-escaped
+#define SOAP_SLOT_INDEX           "\x18"
+#define SOAP_SLOT_COUNT           "\x19"
+#define SOAP_SLOT_CALLBACK        "\x1a"
+#define SOAP_SLOT_SID             "\x1b"
+#define SOAP_SLOT_TIMEOUT         "\x1c"
+#define SOAP_SLOT_RANGE           "\x1d"
+
 // UPnP/SOAP browse/search default parameters
 #define UPNP_URN_SCHEMA_CONTENT_DIRECTORY SSDP_SERVICE_TYPE_CD
 #define SOAP_DEFAULT_BROWSE_FLAG             "BrowseDirectChildren"
+#define SOAP_BROWSE_FLAG_METADATA            "BrowseMetadata"
 #define SOAP_DEFAULT_BROWSE_FILTER           "*"
 #define SOAP_DEFAULT_BROWSE_SORT_CRITERIA    ""
 #define SOAP_DEFAULT_BROWSE_STARTING_INDEX   0
-#define SOAP_DEFAULT_BROWSE_MAX_COUNT        100     // arbitrary value to limit memory usage
+#define SOAP_DEFAULT_BROWSE_MAX_COUNT        100     // arbitrary value to limit memory usage (result list only)
 #define SOAP_DEFAULT_SEARCH_FILTER           "*"
 #define SOAP_DEFAULT_SEARCH_SORT_CRITERIA    ""
 #define SOAP_DEFAULT_SEARCH_STARTING_INDEX   0
-#define SOAP_DEFAULT_SEARCH_MAX_COUNT        100     // arbitrary value to limit memory usage
+#define SOAP_DEFAULT_SEARCH_MAX_COUNT        100     // arbitrary value to limit memory usage (result list only)
+
+// initial sizes of a SoapResultSet, both get doubled when exhausted
+#define SOAP_RESULT_SET_ARENA_SIZE          4096     // bytes for strings
+#define SOAP_RESULT_SET_OBJECTS               32     // number of objects
+
+// browse/search result cache, see setCache()
+#define SOAP_CACHE_DEFAULT_SIZE          32768     // bytes, suggested value for setCache()
+
+// read-ahead of downloads, see setReadAhead()
+#define SOAP_READ_AHEAD_DEFAULT_SIZE     32768     // bytes, suggested value for setReadAhead()
+#define SOAP_READ_AHEAD_STACK             4096     // stack size of the task filling the read-ahead buffer
+#define SOAP_READ_AHEAD_WAIT                10     // ms, task checks fill level at least this often while paused
+
+// cooperative yield while evaluating browse/search replies, see setYieldPolicy()
+#define SOAP_YIELD_DEFAULT_INTERVAL        100     // ms, default policy is yieldWallClock
+
+// segmented download over several connections, see downloadSegmented()
+#define SOAP_SEGMENT_CONNECTIONS             3     // default number of connections
+#define SOAP_SEGMENT_SIZE                16384     // bytes, default segment size (one buffer per connection)
+#define SOAP_SEGMENT_STACK                4096     // stack size of a task fetching segments
 
 #define SOAP_SEARCH_CRITERIA_TITLE   "dc:title contains"
 #define SOAP_SEARCH_CRITERIA_ARTIST  "upnp:artist contains"
@@ -152,20 +233,46 @@
 #define DIDL_ATTR_SAMPLEFREQU  "sampleFrequency="
 #define DIDL_ATTR_PROT_INFO    "protocolInfo="
 
-// for replacing predefined XML entities in server reply
+// DIDL element of no interest, left out of <container>/<item> content while receiving
+#define DIDL_DESC              "desc"
+
+// selected DIDL attributes & elements, all of them get scanned in a single pass over <container>/<item>
+enum eDidlAttr { didlAttrId = 0, didlAttrParentId, didlAttrChildCount, didlAttrSearchable, 
+                 didlAttrSize, didlAttrBitrate, didlAttrSampleFrequ, didlAttrProtInfo, didlAttrCount };
+enum eDidlElement { didlTitle = 0, didlAlbum, didlArtist, didlGenre, didlClass, didlRes, didlElementCount };
+struct didlSpan_t
+{
+  int start;                // offset of value in scanned string
+  int length;               // length of value, -1 if attribute/element missing
+};
+
+// for replacing predefined XML entities & numeric character references in server reply
 enum eXmlReplaceState { xmlPassthrough = 0, xmlAmpDetected, xmlTakeFromBuffer };
-struct replaceWith_t 
+struct xmlEntity_t
 {
-  const char *replace;
-  const char with;
+  const char *name;         // entity name without '&' and ';'
+  const char level1;        // replacement in SOAP, 0: "&amp;" may introduce an entity of embedded DIDL-Lite
+  const char *level2;       // replacement of entity in DIDL-Lite embedded in SOAP ("&amp;lt;")
 };
 
 // defines the data content of a reported item (file/stream)
 enum eFileType { fileTypeOther = 0, fileTypeAudio, fileTypeImage, fileTypeVideo };
 
+// state of de-chunking: chunk size digits, rest of chunk size line (extensions), chunk data, CRLF trailing 
+// chunk data, trailer lines following final chunk
+enum eChunkState { chunkSize = 0, chunkSizeEnd, chunkData, chunkDataEnd, chunkTrailer };
+
 // defines what capabilities to query from server
 enum eCapabilityType { capSearch = 0, capSort };
 
+// request templates
+enum eSoapRequest { reqGet = 0, reqBrowse, reqBrowseMetadata, reqSearch, reqGetSearchCap, reqGetSortCap, reqHead,
+                    reqGetSystemUpdateId, reqSubscribe, reqRenew, reqUnsubscribe };
+
+// values filled into request templates, see SOAP_SLOT_xxx
+enum eSoapSlot { slotUri = 0, slotHost, slotConnection, slotLength, slotObjectId, slotCriteria, slotSort, 
+                 slotIndex, slotCount, slotCallback, slotSid, slotTimeout, slotRange, slotTotal };
+
 typedef std::vector<String> soapServerCapVect_t;
 
 // info collection of a single SOAP object (<container> or <item>) 
@@ -193,6 +300,220 @@ struct soapObject_t
 };
 typedef std::vector<soapObject_t> soapObjectVect_t;
 
+// gets called for each object as soon as it has been scanned, returning false stops browsing/searching
+typedef bool (*soapObjectCallback_t)(const soapObject_t *object, void *arg);
+
+// counters reported by server with each browse/search reply
+struct soapPageInfo_t
+{
+  uint32_t numberReturned;  // objects in this reply
+  uint32_t totalMatches;    // objects in container/matching search, 0 if unknown
+  uint32_t updateId;        // container update id
+  bool     updateIdValid;   // false if server didn't report update id
+};
+
+// when to give up the CPU while evaluating browse/search replies, see setYieldPolicy()
+enum eYieldPolicy { yieldNever = 0,         // never, task watchdog must not watch the idle task of this core
+                    yieldBytes,             // each time interval bytes of objects have been evaluated
+                    yieldWallClock };       // each time interval ms of wall-clock time have passed
+
+// gets called with downloaded data in order, returning false stops the download
+typedef bool (*soapSinkCallback_t)(const uint8_t *data, size_t size, void *arg);
+
+// result of a download request with offset, see readStart()
+enum eRangeStatus { rangeError = 0,         // request failed (no connection, HTTP error, unknown size)
+                    rangePartial,           // server delivers requested range (206 Partial Content)
+                    rangeFull,              // server ignored range but offset is 0, read() delivers requested length
+                    rangeIgnored,           // server doesn't support ranges, download not possible from offset
+                    rangeNotSatisfiable };  // offset beyond end of file (416 Range Not Satisfiable)
+
+struct soapRange_t
+{
+  eRangeStatus status;
+  uint64_t first;           // offset of first byte delivered by read()
+  uint64_t size;            // number of bytes delivered by read()
+  uint64_t total;           // file size, 0 if unknown
+};
+
+// asynchronous requests: called when browse/search has finished, ok & page like browseServer() 
+typedef void (*soapDoneCallback_t)(bool ok, const soapPageInfo_t *page, void *arg);
+// asynchronous requests: called when download is ready for read(), ok & size like readStart()
+typedef void (*soapReadyCallback_t)(bool ok, size_t size, void *arg);
+
+// state of a paged browse/search, see browseStart(), searchStart() and nextPage()
+struct soapCursor_t
+{
+  unsigned int srv;         // server number in list
+  String   objectId;        // container to browse/search
+  bool     search;          // false: browse
+  String   searchCriteria;  
+  String   sortCriteria;
+  uint16_t pageSize;        // objects requested per page
+  uint32_t startingIndex;   // starting index of next page
+  uint32_t totalMatches;    // as reported by server, 0 if unknown
+  uint32_t pages;           // pages delivered so far
+  uint32_t updateId;        // container update id reported with first page
+  bool     updateIdChanged; // container got modified while paging
+  uint32_t prefetchTag;     // identifies request for next page if already sent
+  bool     done;            // no more pages
+};
+
+// compact form of a soapObject_t inside a SoapResultSet, strings are kept as offsets into the set's arena
+struct soapCompactObject_t
+{
+  uint64_t size;
+  uint32_t parentId;
+  uint32_t id;
+  uint32_t name;
+  uint32_t artist;
+  uint32_t album;
+  uint32_t genre;
+#if !defined(NO_PROTOCOL_INFO)
+  uint32_t protInfo;
+#endif
+  uint32_t uri;
+  uint32_t downloadIp;
+  int32_t  bitrate;
+  int32_t  sampleFrequency;
+  uint16_t downloadPort;
+  uint8_t  fileType;
+  bool     isDirectory;
+  bool     sizeMissing;
+  bool     searchable;
+};
+
+// view of an object stored in a SoapResultSet, pointers are valid until the set gets changed
+struct soapObjectView_t
+{
+  bool isDirectory;
+  uint64_t size;
+  bool sizeMissing;
+  int  bitrate;
+  int  sampleFrequency;
+  bool searchable;
+  eFileType fileType;
+  const char *parentId;
+  const char *id;
+  const char *name;
+  const char *artist;
+  const char *album;
+  const char *genre;
+#if !defined(NO_PROTOCOL_INFO)
+  const char *protInfo;
+#endif
+  const char *uri;
+  IPAddress downloadIp;
+  uint16_t downloadPort;
+};
+
+// result list keeping all strings of a browse/search in a single arena, the parent id is stored 
+// only once. Memory is kept when the set gets reused, so browsing doesn't fragment the heap.
+class SoapResultSet
+{
+  public:
+    SoapResultSet(size_t arenaSize = SOAP_RESULT_SET_ARENA_SIZE, size_t objects = SOAP_RESULT_SET_OBJECTS);
+    ~SoapResultSet();
+    SoapResultSet(const SoapResultSet &) = delete;
+    SoapResultSet &operator=(const SoapResultSet &) = delete;
+
+    void          clear(const char *parentId = "");
+    bool          add(const soapObject_t *object);
+    size_t        size(void) const { return m_count; }
+    bool          full(void) const { return m_full; }
+    bool          get(size_t index, soapObjectView_t *view) const;
+    bool          getObject(size_t index, soapObject_t *object) const;
+    const char*   getParentId(void) const;
+    size_t        getMemoryUsage(void) const;
+    void          setMemoryLimit(size_t limit) { m_limit = limit; }
+    bool          assign(const SoapResultSet *other);
+
+  private:
+    char                *m_arena;         // all strings, each terminated with '\0', offset 0 is empty string
+    size_t               m_arenaSize;
+    size_t               m_arenaUsed;
+    soapCompactObject_t *m_objects;
+    size_t               m_objectsSize;
+    size_t               m_count;
+    uint32_t             m_parentId;      // offset of parent id shared by objects
+    bool                 m_full;          // last add() failed for lack of memory (or memory limit reached)
+    size_t               m_limit;         // max. memory the set may allocate, 0: no limit
+
+    bool     reserve(size_t bytes, size_t objects);
+    bool     storeString(const char *str, uint32_t *offset);
+};
+
+// asynchronous request & reply evaluation state, device description fetch, defined in SoapESP32.cpp
+struct soapAsync_t;
+struct soapSeek_t;
+struct soapReply_t;
+struct soapDescriptionJob_t;
+struct soapCacheEntry_t;
+struct soapReadAhead_t;
+struct soapSegmentJob_t;
+struct soapEventRx_t;
+
+// counters of the browse/search result cache, see getCacheStats()
+struct soapCacheStats_t
+{
+  uint32_t hits;            // requests answered from cache
+  uint32_t misses;          // requests sent to server while cache was enabled
+  uint32_t invalidated;     // entries dropped because server reported a changed update id
+  uint32_t evicted;         // entries dropped for lack of space, least recently used first
+  unsigned int entries;     // entries currently held
+  size_t   memory;          // bytes currently held
+  size_t   maxMemory;       // limit set with setCache()
+};
+
+// state of the read-ahead buffer of a download, see getReadAheadStats()
+struct soapReadAheadStats_t
+{
+  size_t   size;            // buffer size set with setReadAhead(), 0 if disabled
+  size_t   fill;            // bytes buffered right now
+  size_t   minFill;         // lowest fill level found by read() since it delivered the first byte
+  uint32_t underruns;       // read() found the buffer empty before the download was complete
+  uint32_t pauses;          // reading from server paused at high watermark
+  uint64_t received;        // bytes received from server
+  uint64_t delivered;       // bytes delivered by read()
+};
+
+// usage of the SPI bus shared via semaphore (Ethernet only), see getSPIStats()
+struct soapSPIStats_t
+{
+  uint32_t acquisitions;    // semaphore taken
+  uint32_t maxWaitUs;       // longest wait for semaphore
+  uint32_t maxHoldUs;       // longest time semaphore held
+  uint64_t waitUs;          // total time waiting for semaphore
+  uint64_t holdUs;          // total time semaphore held
+};
+
+// timing breakdown of the last request, see getLastRequestStats() (needs build option SOAP_REQUEST_STATS)
+//  - times in us since the request was started, 0 if that step wasn't reached
+struct soapRequestStats_t
+{
+  uint32_t connectUs;       // connected to server (or kept-alive connection reused)
+  uint32_t sentUs;          // request sent
+  uint32_t firstByteUs;     // first byte of reply received
+  uint32_t headerUs;        // HTTP header evaluated
+  uint32_t parsedUs;        // reply completely evaluated, with downloads: readStop() called
+  uint32_t totalUs;         // request done (also in case of failure)
+  uint8_t  connectAttempts; // 0 if kept-alive connection reused
+  bool     cached;          // browse/search answered from cache, no request sent
+  uint64_t bytes;           // bytes received incl. HTTP header & chunk framing
+  uint32_t chunks;          // chunks of a chunked reply
+  uint32_t objects;         // objects found in browse/search reply
+  uint32_t rejected;        // objects dropped (e.g. vital attributes missing)
+  uint32_t scanUs;          // time spent scanning DIDL-Lite objects (part of parsedUs)
+  int32_t  heapDelta;       // free heap at end minus free heap at start
+};
+
+// last SystemUpdateID reported by a server, see validateCache()
+struct soapSystemUpdateId_t
+{
+  IPAddress ip;
+  uint16_t  port;
+  uint32_t  updateId;
+};
+
 // keeps vital infos of each media server
 struct soapServer_t
 {
@@ -201,9 +522,60 @@ struct soapServer_t
   String location;
   String friendlyName;
   String controlURL;
+  String eventURL;          // ContentDirectory event subscription URL, empty if not provided
+  String udn;               // unique device name taken from SSDP USN, e.g. "uuid:4d696e69-444c-164e-9d41-b827eb54e86a"
 };
 typedef std::vector<soapServer_t> soapServerVect_t;
 
+// gets called by seekServerUntil() (by poll() with seekServerAsync()) for each server delivering content 
+// as soon as it has been checked, returning false stops seeking
+typedef bool (*soapServerCallback_t)(const soapServer_t *server, void *arg);
+
+// gets called by poll() when seeking started by seekServerAsync() is over, servers: number of servers found
+typedef void (*soapSeekDoneCallback_t)(unsigned int servers, void *arg);
+
+// conditions for seekServerUntil()/seekServerAsync() to stop seeking before the scan duration is over, 0/NULL: not used
+struct soapSeekUntil_t
+{
+  unsigned int servers;       // this number of servers delivering content found
+  const char  *friendlyName;  // server with this friendly name found
+  const char  *udn;           // server with this unique device name found
+  uint32_t     quietPeriod;   // ms, no new server answered for this time (counted from start as well, 
+                              // but not before SSDP_M_SEARCH_MX_FAST has passed) and all servers found are checked
+};
+
+// changed container as reported by a ContentDirectory event
+struct soapContainerUpdate_t
+{
+  String   id;
+  uint32_t updateId;
+};
+
+// ContentDirectory event of a subscribed server, see subscribeEvents()
+struct soapEvent_t
+{
+  unsigned int srv;                 // server number in list
+  uint32_t seq;                     // event key, 0 with initial event after subscribing
+  bool     systemUpdateIdValid;     // false if event didn't carry SystemUpdateID
+  uint32_t systemUpdateId;
+  std::vector<soapContainerUpdate_t> containers;   // from ContainerUpdateIDs, empty if not carried
+};
+
+// gets called by poll() for each event received
+typedef void (*soapEventCallback_t)(const soapEvent_t *event, void *arg);
+
+// event subscription of a server, see subscribeEvents()
+struct soapSubscription_t
+{
+  IPAddress ip;
+  uint16_t  port;
+  String    eventURL;
+  String    sid;                    // subscription id assigned by server, empty if subscription got lost
+  uint32_t  timeout;                // s, requested duration
+  uint32_t  renewAt;                // millis() when subscription gets renewed (or subscribed again)
+  uint32_t  seq;                    // next expected event key
+};
+
 // SoapESP32 class
 class SoapESP32
 {
@@ -213,13 +585,43 @@ class SoapESP32
 #else
     SoapESP32(WiFiClient *client, WiFiUDP *udp = NULL);
 #endif
+    ~SoapESP32();
     bool          wakeUpServer(const char *macWOL);
     void          clearServerList(void);
-    bool          addServer(IPAddress ip, uint16_t port, const char *controlURL, const char *name = "My Media Server");
+    void          setKeepAlive(bool enable);
+    bool          setReadAhead(size_t bufferSize, size_t lowWatermark = 0, size_t highWatermark = 0);
+    void          getReadAheadStats(soapReadAheadStats_t *stats);
+    void          getSPIStats(soapSPIStats_t *stats, bool reset = false);
+    bool          getLastRequestStats(soapRequestStats_t *stats);
+    void          setSeekConcurrency(unsigned int maxParallel);
+    void          setYieldPolicy(eYieldPolicy policy, uint32_t interval = SOAP_YIELD_DEFAULT_INTERVAL);
+    bool          addServer(IPAddress ip, uint16_t port, const char *controlURL, const char *name = "My Media Server",
+                            const char *eventURL = NULL);
     unsigned int  seekServer(unsigned int scanDuration = SSDP_SCAN_DURATION);
+    unsigned int  seekServerUntil(const soapSeekUntil_t *until, soapServerCallback_t callback = NULL, void *arg = NULL,
+                                  unsigned int scanDuration = SSDP_SCAN_DURATION);
+    bool          seekServerAsync(const soapSeekUntil_t *until, soapServerCallback_t callback, soapSeekDoneCallback_t done,
+                                  void *arg = NULL, unsigned int scanDuration = SSDP_SCAN_DURATION);
+    bool          saveServerList(Print *stream);
+    bool          loadServerList(Stream *stream);
+    unsigned int  validateServerList(void);
+    unsigned int  restoreServerList(Stream *stream, unsigned int scanDuration = SSDP_SCAN_DURATION);
     unsigned int  getServerCount(void);
     bool          getServerInfo(unsigned int srv, soapServer_t *serverInfo);
     bool          getServerCapabilities(const unsigned int srv, eCapabilityType capability, soapServerCapVect_t *result);
+    bool          getSystemUpdateId(const unsigned int srv, uint32_t *updateId);
+    void          setCache(size_t maxMemory);
+    void          clearCache(void);
+    unsigned int  invalidateCache(const unsigned int srv, const char *objectId = NULL);
+    bool          validateCache(const unsigned int srv);
+    void          getCacheStats(soapCacheStats_t *stats);
+#ifdef USE_ETHERNET
+    bool          setEventListener(EthernetServer *server, uint16_t port, soapEventCallback_t callback = NULL, void *arg = NULL);
+#else
+    bool          setEventListener(WiFiServer *server, uint16_t port, soapEventCallback_t callback = NULL, void *arg = NULL);
+#endif
+    bool          subscribeEvents(const unsigned int srv, uint32_t timeout = GENA_SUBSCRIPTION_TIMEOUT);
+    bool          unsubscribeEvents(const unsigned int srv);
     bool          browseServer(const unsigned int srv, const char *objectId, soapObjectVect_t *browseResult, 
                                const uint32_t startingIndex = SOAP_DEFAULT_BROWSE_STARTING_INDEX, 
                                const uint16_t maxCount      = SOAP_DEFAULT_BROWSE_MAX_COUNT);
@@ -230,11 +632,62 @@ class SoapESP32
                                const char *sortCriteria     = NULL,
                                const uint32_t startingIndex = SOAP_DEFAULT_SEARCH_STARTING_INDEX, 
                                const uint16_t maxCount      = SOAP_DEFAULT_SEARCH_MAX_COUNT);                             
+    bool          browseServer(const unsigned int srv, const char *objectId, SoapResultSet *browseResult, 
+                               const uint32_t startingIndex = SOAP_DEFAULT_BROWSE_STARTING_INDEX, 
+                               const uint16_t maxCount      = SOAP_DEFAULT_BROWSE_MAX_COUNT);
+    bool          searchServer(const unsigned int srv, const char *containerId, SoapResultSet *searchResult,
+                               const char *searchCriteria1, const char *param1,
+                               const char *searchCriteria2  = NULL,
+                               const char *param2           = NULL,
+                               const char *sortCriteria     = NULL,
+                               const uint32_t startingIndex = SOAP_DEFAULT_SEARCH_STARTING_INDEX, 
+                               const uint16_t maxCount      = SOAP_DEFAULT_SEARCH_MAX_COUNT);                             
+    bool          browseServer(const unsigned int srv, const char *objectId, soapObjectCallback_t callback, void *arg = NULL,
+                               const uint32_t startingIndex = SOAP_DEFAULT_BROWSE_STARTING_INDEX, 
+                               const uint16_t maxCount      = SOAP_DEFAULT_BROWSE_MAX_COUNT);
+    bool          searchServer(const unsigned int srv, const char *containerId, soapObjectCallback_t callback, void *arg,
+                               const char *searchCriteria1, const char *param1,
+                               const char *searchCriteria2  = NULL,
+                               const char *param2           = NULL,
+                               const char *sortCriteria     = NULL,
+                               const uint32_t startingIndex = SOAP_DEFAULT_SEARCH_STARTING_INDEX, 
+                               const uint16_t maxCount      = SOAP_DEFAULT_SEARCH_MAX_COUNT);                             
+    bool          browseStart(const unsigned int srv, const char *objectId, soapCursor_t *cursor,
+                              const uint16_t pageSize = SOAP_DEFAULT_BROWSE_MAX_COUNT);
+    bool          searchStart(const unsigned int srv, const char *containerId, soapCursor_t *cursor,
+                              const char *searchCriteria1, const char *param1,
+                              const char *searchCriteria2  = NULL,
+                              const char *param2           = NULL,
+                              const char *sortCriteria     = NULL,
+                              const uint16_t pageSize      = SOAP_DEFAULT_SEARCH_MAX_COUNT);
+    bool          nextPage(soapCursor_t *cursor, soapObjectVect_t *result);
+    bool          nextPage(soapCursor_t *cursor, SoapResultSet *result);
+    void          stopPaging(soapCursor_t *cursor);
+    bool          browseServerAsync(const unsigned int srv, const char *objectId, 
+                                    soapObjectCallback_t callback, soapDoneCallback_t done, void *arg = NULL,
+                                    const uint32_t startingIndex = SOAP_DEFAULT_BROWSE_STARTING_INDEX, 
+                                    const uint16_t maxCount      = SOAP_DEFAULT_BROWSE_MAX_COUNT);
+    bool          searchServerAsync(const unsigned int srv, const char *containerId, 
+                                    soapObjectCallback_t callback, soapDoneCallback_t done, void *arg,
+                                    const char *searchCriteria1, const char *param1,
+                                    const char *searchCriteria2  = NULL,
+                                    const char *param2           = NULL,
+                                    const char *sortCriteria     = NULL,
+                                    const uint32_t startingIndex = SOAP_DEFAULT_SEARCH_STARTING_INDEX, 
+                                    const uint16_t maxCount      = SOAP_DEFAULT_SEARCH_MAX_COUNT);
+    bool          readStartAsync(soapObject_t *object, soapReadyCallback_t ready, void *arg = NULL);
+    bool          poll(void);
+    void          cancelRequest(void);
     bool          readStart(soapObject_t *object, size_t *size);
+    bool          readStart(soapObject_t *object, uint64_t offset, uint64_t length, soapRange_t *range);
     int           read(uint8_t *buf, size_t size, uint32_t timeout = SERVER_READ_TIMEOUT);
+    bool          readTo(soapSinkCallback_t sink, void *arg = NULL, uint64_t *size = NULL);
     int           read(void);
     void          readStop(void);
     size_t        available(void);
+    bool          downloadSegmented(soapObject_t *object, soapSinkCallback_t sink, void *arg = NULL,
+                                    unsigned int connections = SOAP_SEGMENT_CONNECTIONS, 
+                                    size_t segmentSize = SOAP_SEGMENT_SIZE);
     const char*   getFileTypeName(eFileType fileType);
 
   private:
@@ -247,28 +700,193 @@ class SoapESP32
     WiFiUDP           *m_udp;                   // pointer to WiFiUDP object
 #endif    
     bool               m_clientDataConOpen;     // marker: socket open for reading file
-    size_t             m_clientDataAvailable;   // file read count
+    uint64_t           m_clientDataAvailable;   // file read count
     bool               m_clientDataChunked;     // some servers deliver chunked data when reading files
     soapServerVect_t   m_server ;               // list of usable media servers in local network
     int                m_ChunkCount;            // nr of bytes left of chunk (0 = end of chunk, next line delivers chunk size)
     eXmlReplaceState   m_xmlReplaceState;       // state machine for replacing XML entities
-    uint8_t            m_xmlReplaceOffset;
-    char               m_xmlReplaceBuffer[15];  // Fits longest string in replaceWith[] array
+    uint8_t            m_xmlReplaceOffset;      // next character to take from m_xmlReplaceBuffer
+    uint8_t            m_xmlReplaceLength;      // characters collected/to be taken in m_xmlReplaceBuffer
+    bool               m_xmlReplacePending;     // '&' ending an invalid entity starts the next one
+    char               m_xmlReplaceBuffer[15];  // fits longest sequence: "&amp;#x10FFFF;" plus one character
+    uint8_t            m_rxBuffer[SOAP_RX_BUFFER_SIZE]; // receive buffer for HTTP header & XML data
+    size_t             m_rxHead;                // next byte to deliver from receive buffer
+    size_t             m_rxTail;                // end of valid data in receive buffer
+    uint8_t            m_txBuffer[SOAP_TX_BUFFER_SIZE]; // transmit buffer for requests
+    size_t             m_txFill;                // bytes waiting in transmit buffer
+    bool               m_prefetchPending;       // request for next page of a paged browse/search sent
+    uint32_t           m_prefetchTag;           // identifies cursor the prefetched request belongs to
+    bool               m_keepAlive;             // keep connection open for consecutive requests
+    bool               m_conIdle;               // connection open & ready for next request
+    bool               m_conClose;              // server announced closing of connection after reply
+    IPAddress          m_conIp;                 // server of open connection
+    uint16_t           m_conPort;
+    uint64_t           m_bodyRemaining;         // bytes left of reply body (not chunked), UINT64_MAX if unknown
+    bool               m_chunkEnd;              // final chunk of chunked reply read
+    eChunkState        m_chunkState;            // de-chunking of XML data & downloads
+    uint8_t            m_chunkDigits;           // digits of chunk size/characters of trailer line read so far
+    bool               m_conReused;             // last request was sent on a kept-alive connection
+    uint32_t           m_rxLast;                // millis() of last data received
+    soapAsync_t       *m_async;                 // asynchronous request in progress, NULL if none
+    soapSeek_t        *m_seek;                  // seeking started by seekServerAsync(), NULL if none
+    uint32_t           m_deadline;              // millis() by which current request must be finished, 0 if none
+    unsigned int       m_seekParallel;          // max. number of device descriptions fetched at once
+    std::vector<soapCacheEntry_t *> m_cache;    // cached browse/search results
+    size_t             m_cacheMax;              // max. memory used by cache, 0: cache disabled
+    uint32_t           m_cacheTick;             // incremented with each cache access, for LRU eviction
+    soapCacheStats_t   m_cacheStats;
+    std::vector<soapSystemUpdateId_t> m_systemUpdateIds; // last SystemUpdateID seen per server
+#ifdef USE_ETHERNET
+    EthernetServer    *m_eventServer;           // receives event messages (GENA NOTIFY), NULL if none
+#else
+    WiFiServer        *m_eventServer;
+#endif
+    uint16_t           m_eventPort;
+    soapEventCallback_t m_eventCallback;
+    void              *m_eventArg;
+    std::vector<soapSubscription_t> m_subscriptions;
+    soapEventRx_t     *m_eventRx;               // event message being received, NULL if none
+    soapReadAhead_t   *m_readAhead;             // read-ahead of downloads, NULL if disabled
+    int                m_httpStatus;            // status code of last reply
+    bool               m_rangeRequest;          // download of a range requested, 206 Partial Content is fine
+    soapRange_t        m_contentRange;          // Content-Range of last reply, size 0 if none
+    soapSPIStats_t     m_SPIStats;
+    uint32_t           m_SPIClaimed;            // micros() when semaphore was taken
+    eYieldPolicy       m_yieldPolicy;
+    uint32_t           m_yieldInterval;         // bytes or ms, depending on policy
+    uint32_t           m_yieldBytes;            // bytes evaluated since last yield
+    uint32_t           m_yieldLast;             // millis() of last yield
+#ifdef SOAP_REQUEST_STATS
+    soapRequestStats_t m_reqStats;              // request in progress
+    soapRequestStats_t m_reqStatsLast;          // last request done
+    uint32_t           m_reqStart;              // micros() when request was started
+    uint32_t           m_reqScanStart;          // micros() when scanning of current object was started
+    uint32_t           m_reqHeap;               // free heap when request was started
+    bool               m_reqOpen;               // request in progress, m_reqStats not yet copied
+#endif
 
+#ifdef USE_ETHERNET
+    void soapClaimSPI(void);
+    void soapReleaseSPI(void);
+#endif
+#ifdef SOAP_REQUEST_STATS
+    void soapStatsStart(void);
+    void soapStatsReceived(int len);
+    void soapStatsEnd(void);
+#endif
+    void soapYield(size_t bytes);
+    bool soapClientFill(unsigned long ms = 0);
     int  soapClientTimedRead(unsigned long ms = 0);
-    bool soapUDPmulticast(unsigned int repeats = 0);
+    int  soapClientRead(uint8_t *buf, size_t size);
+    int  soapClientSpan(const uint8_t **data, size_t size);
+    int  soapClientReadByte(bool wait);
+    int  soapClientRefill(bool wait);
+    int  soapChunkData(bool wait);
+    void soapChunkConsume(size_t size);
+    size_t soapClientReadLine(char *buf, size_t length, unsigned long ms = 0);
+    unsigned long soapTimeLeft(unsigned long ms);
+    bool soapConnect(const IPAddress ip, const uint16_t port, bool *reused);
+    size_t soapSerialize(const char *tpl, const char **slot, bool send);
+    void soapTxPut(const char *data, size_t length);
+    void soapTxFlush(void);
+    bool soapSendRequest(const IPAddress ip, const uint16_t port, eSoapRequest request, const char **slot, bool waitForReply);
+    bool soapSkipBody(bool chunked);
+    void soapClientRelease(bool reusable);
+    bool soapUDPmulticast(unsigned int repeats = 0, unsigned int mx = SSDP_M_SEARCH_MX);
+    int  soapSSDPreceive(soapServerVect_t *result, uint32_t start);
     bool soapSSDPquery(std::vector<soapServer_t> *rcvd, int msWait);
-    bool soapGet(const IPAddress ip, const uint16_t port, const char *uri);
+    bool soapGetDescription(soapServer_t *srv);
+    bool soapCheckLocation(const soapServer_t *srv);
+    static void soapDescriptionTask(void *arg);
+    soapDescriptionJob_t *soapDescriptionStart(const soapServer_t *srv, bool task, bool validate = false);
+    static void soapDescriptionRelease(soapDescriptionJob_t *job);
+    void soapCheckServers(soapServerVect_t *servers, bool validate);
+    bool soapSeekStart(soapSeek_t *seek, const soapSeekUntil_t *until, soapServerCallback_t callback, void *arg,
+                       unsigned int scanDuration, bool task);
+    bool soapSeekStep(soapSeek_t *seek, bool *idle);
+    unsigned int soapSeekEnd(soapSeek_t *seek);
+    void soapCancelSeek(void);
+    bool soapGet(const IPAddress ip, const uint16_t port, const char *uri, bool waitForReply = true, 
+                 const char *range = NULL);
     bool soapPost(const IPAddress ip, const uint16_t port, const char *uri, const char *objectId, 
-                  const char *searchCriteria, const char *sortCriteria, const uint32_t startingIndex, const uint16_t maxCount);                        
-    bool soapPostCapabilities(const IPAddress ip, const uint16_t port, const char *uri, eCapabilityType capability);
+                  const char *searchCriteria, const char *sortCriteria, const uint32_t startingIndex, const uint16_t maxCount,
+                  bool waitForReply = true);                        
+    bool soapPostAction(const IPAddress ip, const uint16_t port, const char *uri, eSoapRequest request);
+    bool soapQueryValue(const unsigned int srv, eSoapRequest request, int xpath, String *value);
     bool soapReadHttpHeader(uint64_t *contentLength, bool *chunked = NULL);
-    int  soapReadXML(bool chunked = false, bool replace = false);
-    bool soapScanAttribute(const String *attributes, String *result, const char *searchFor);
+    int  soapHttpHeaderLine(char *line, size_t len, bool first, uint64_t *contentLength, bool *chunked, bool *ok);
+    void soapHttpHeaderEnd(bool ok, uint64_t contentLength, bool *chunked);
+    int  soapReadXML(bool chunked = false, bool replace = false, bool wait = true);
+    int  soapReadXMLBlock(bool chunked, char *buf, size_t size, bool wait = true);
+    void soapScanDidlAttributes(const String *str, int start, int end, didlSpan_t *attr);
+    void soapScanDidlElements(const String *content, didlSpan_t *value, didlSpan_t *resAttr);
+    bool soapScanAttribute(const String *str, const didlSpan_t *attr, eDidlAttr what, String *result);
     bool soapScanContainer(const String *parentId, const String *attributes, const String *container, soapObjectVect_t *browseResult);
     bool soapScanItem(const String *parentId, const String *attributes, const String *item, soapObjectVect_t *browseResult);
     bool soapProcessRequest(const unsigned int srv, const char *objectId, soapObjectVect_t *result, const char *searchCriteria, 
-                            const char *sortCriteria, const uint32_t startingIndex, const uint16_t maxCount); 
+                            const char *sortCriteria, const uint32_t startingIndex, const uint16_t maxCount,
+                            soapObjectCallback_t callback = NULL, void *arg = NULL, soapPageInfo_t *page = NULL); 
+    soapCacheEntry_t *soapCacheFind(const unsigned int srv, uint32_t hash, const char *objectId, const char *searchCriteria,
+                                    const char *sortCriteria, const uint32_t startingIndex, const uint16_t maxCount);
+    bool soapCacheReplay(soapCacheEntry_t *entry, soapObjectVect_t *result, soapObjectCallback_t callback, void *arg,
+                         soapPageInfo_t *page);
+    void soapCacheStore(const unsigned int srv, uint32_t hash, const char *objectId, const char *searchCriteria,
+                        const char *sortCriteria, const uint32_t startingIndex, const uint16_t maxCount,
+                        const SoapResultSet *set, const soapPageInfo_t *page);
+    unsigned int soapCacheDrop(const IPAddress ip, const uint16_t port, const char *objectId, const soapPageInfo_t *page);
+    void soapCacheEvict(size_t maxMemory);
+    void soapCacheErase(size_t index);
+    bool soapSystemUpdateIdChanged(const IPAddress ip, const uint16_t port, uint32_t updateId);
+    bool soapUnsubscribe(soapSubscription_t *sub);
+    void soapUnsubscribeAll(void);
+    bool soapSubscribeSend(const IPAddress ip, const uint16_t port, const char *eventURL, const char *sid,
+                           uint32_t timeout, bool waitForReply);
+    bool soapSubscribe(soapSubscription_t *sub, bool renew);
+    void soapSubscribeApply(soapSubscription_t *sub, bool renew, const String *sid, uint32_t granted);
+    void soapSubscribeFailed(soapSubscription_t *sub, bool renew);
+    void soapSubscribeAsync(soapSubscription_t *sub);
+    void soapEventPoll(void);
+    void soapEventReceive(void);
+    const char *soapEventHeaderLine(soapEventRx_t *rx);
+    void soapEventDrop(void);
+    void soapEventApply(soapSubscription_t *sub, soapEvent_t *event, bool missed);
+    bool soapProcessReply(const char *objectId, const bool search, soapObjectVect_t *result, 
+                          soapObjectCallback_t callback, void *arg, soapPageInfo_t *page); 
+    void soapReplyStart(soapReply_t *reply, const char *objectId, const bool search, const bool chunked,
+                        soapObjectVect_t *result, soapObjectCallback_t callback, void *arg);
+    int  soapReplyParse(soapReply_t *reply, bool wait);
+    void soapReplyEnd(soapReply_t *reply, bool complete, soapPageInfo_t *page);
+    bool soapDownloadStart(uint64_t contentSize, bool chunked, uint64_t objectSize, uint64_t *size,
+                           uint64_t maxSize = SIZE_MAX);
+    bool soapAsyncSend(void);
+#ifndef USE_ETHERNET
+    int  soapAsyncConnect(void);
+#endif
+    void soapAsyncFinish(bool ok, const soapPageInfo_t *page = NULL, size_t size = 0);
+    void soapCancelAsync(bool report);
+    bool soapDropAsync(void);
+    int  soapDownloadRead(uint8_t *buf, size_t size, uint32_t timeout, const uint8_t **span = NULL);
+    void soapReadAheadStart(void);
+    void soapReadAheadStop(void);
+    static void soapReadAheadTask(void *arg);
+    void soapReadAheadFill(void);
+    int  soapReadAheadRead(uint8_t *buf, size_t size, uint32_t timeout);
+    int  soapReadAheadWait(uint32_t timeout);
+    void soapReadAheadConsume(size_t size);
+    soapSegmentJob_t *soapSegmentStart(const soapObject_t *object, uint64_t total, size_t segmentSize, 
+                                       unsigned int workers);
+    static void soapSegmentTask(void *arg);
+    static void soapSegmentRelease(soapSegmentJob_t *job);
+    bool soapSegmentFetch(const soapObject_t *object, uint64_t offset, size_t length, uint8_t *buffer);
+    bool soapProcessSearch(const unsigned int srv, const char *objectId, soapObjectVect_t *result, 
+                           soapObjectCallback_t callback, void *arg, const char *searchCriteria1, const char *param1, 
+                           const char *searchCriteria2, const char *param2, const char *sortCriteria, 
+                           const uint32_t startingIndex, const uint16_t maxCount);
+    void soapSearchCriteria(String *search, String *sort, const char *searchCriteria1, const char *param1, 
+                            const char *searchCriteria2, const char *param2, const char *sortCriteria);
+    bool soapSendPage(soapCursor_t *cursor, bool waitForReply);
+    void soapCancelPrefetch(void);
+    bool soapNextPage(soapCursor_t *cursor, soapObjectVect_t *result, soapObjectCallback_t callback, void *arg);
 };
 
 #endif
\ No newline at end of file